@@ -9,6 +9,7 @@
 #include "IContentBrowserSingleton.h"
 #include "Dialogs/Dialogs.h"
 #include "GraphEditor.h"
+#include "SGraphPanel.h"
 #include "Selection.h"
 #include "ObjectTools.h"
 #include "Filters/SFilterBar.h"
@@ -19,6 +20,11 @@
 #include "Widgets/Docking/SDockTab.h"
 #include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Input/SSpinBox.h"
+#include "Widgets/Layout/SScaleBox.h"
+#include "Widgets/Notifications/SProgressBar.h"
+#include "Rendering/SlateRenderer.h"
+#include "Engine/Texture2D.h"
+#include "UObject/StrongObjectPtr.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/AssetManager.h"
 #include "HAL/PlatformApplicationMisc.h"
@@ -26,6 +32,23 @@
 #include "SCommentBubble.h"
 #include "UObject/UnrealTypePrivate.h"
 #include "UObject/UnrealType.h"
+#include "UObject/PropertyTag.h"
+#include "UObject/StructOnScope.h"
+#include "UObject/UObjectIterator.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/InheritableComponentHandler.h"
+#include "UObject/ObjectResource.h"
+#include "PackageReader.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Algo/StableSort.h"
+#include "Algo/MaxElement.h"
+#include "FileHelpers.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 #define LOCTEXT_NAMESPACE "FRefExplorerEditorModule"
 
@@ -39,6 +62,8 @@ namespace FRefExplorerEditorModule_PRIVATE
 {
 	const FSlateFontInfo Small(FONT(8, "Regular"));
 	const FSlateFontInfo SmallBold(FONT(8, "Bold"));
+	const FSlateFontInfo SummaryBold(FONT(48, "Bold"));
+	const FSlateFontInfo LiteLabel(FONT(14, "Bold"));
 
 	enum class EDependencyPinCategory
 	{
@@ -50,6 +75,11 @@ namespace FRefExplorerEditorModule_PRIVATE
 		LinkTypeUsedInGame = 2,
 		LinkTypeHard = 4,
 		LinkTypeMask = LinkTypeHard | LinkTypeUsedInGame,
+
+		LinkStateSaved = 0,
+		LinkStateUnsaved = 8,
+		LinkStateRemoved = 16,
+		LinkStateMask = LinkStateUnsaved | LinkStateRemoved,
 	};
 	ENUM_CLASS_FLAGS(EDependencyPinCategory);
 
@@ -60,11 +90,15 @@ namespace FRefExplorerEditorModule_PRIVATE
 		FName NameHardEditorOnly(TEXT("HardEditorOnly"));
 		FName NameSoftUsedInGame(TEXT("Soft"));
 		FName NameSoftEditorOnly(TEXT("SoftEditorOnly"));
+		FName NameUnsaved(TEXT("Unsaved"));
+		FName NameRemoved(TEXT("Removed"));
 		const FLinearColor ColorPassive = FLinearColor(128, 128, 128);
 		const FLinearColor ColorHardUsedInGame = FLinearColor(FColor(236, 252, 227)); // RiceFlower
 		const FLinearColor ColorHardEditorOnly = FLinearColor(FColor(118, 126, 114));
 		const FLinearColor ColorSoftUsedInGame = FLinearColor(FColor(145, 66, 117)); // CannonPink
 		const FLinearColor ColorSoftEditorOnly = FLinearColor(FColor(73, 33, 58));
+		const FLinearColor ColorUnsaved = FLinearColor(FColor(255, 170, 0));
+		const FLinearColor ColorRemoved = FLinearColor(FColor(160, 40, 40));
 	}
 
 	EDependencyPinCategory ParseDependencyPinCategory(const FName PinCategory)
@@ -85,6 +119,14 @@ namespace FRefExplorerEditorModule_PRIVATE
 		{
 			return EDependencyPinCategory::LinkEndActive;
 		}
+		else if (PinCategory == DependencyPinCategory::NameUnsaved)
+		{
+			return EDependencyPinCategory::LinkEndActive | EDependencyPinCategory::LinkStateUnsaved;
+		}
+		else if (PinCategory == DependencyPinCategory::NameRemoved)
+		{
+			return EDependencyPinCategory::LinkEndActive | EDependencyPinCategory::LinkStateRemoved;
+		}
 		else
 		{
 			return EDependencyPinCategory::LinkEndPassive;
@@ -97,6 +139,14 @@ namespace FRefExplorerEditorModule_PRIVATE
 		{
 			return DependencyPinCategory::NamePassive;
 		}
+		else if (!!(Category & EDependencyPinCategory::LinkStateUnsaved))
+		{
+			return DependencyPinCategory::NameUnsaved;
+		}
+		else if (!!(Category & EDependencyPinCategory::LinkStateRemoved))
+		{
+			return DependencyPinCategory::NameRemoved;
+		}
 		else
 		{
 			switch (Category & EDependencyPinCategory::LinkTypeMask)
@@ -119,6 +169,14 @@ namespace FRefExplorerEditorModule_PRIVATE
 		{
 			return DependencyPinCategory::ColorPassive;
 		}
+		else if (!!(Category & EDependencyPinCategory::LinkStateUnsaved))
+		{
+			return DependencyPinCategory::ColorUnsaved;
+		}
+		else if (!!(Category & EDependencyPinCategory::LinkStateRemoved))
+		{
+			return DependencyPinCategory::ColorRemoved;
+		}
 		else
 		{
 			switch (Category & EDependencyPinCategory::LinkTypeMask)
@@ -135,23 +193,58 @@ namespace FRefExplorerEditorModule_PRIVATE
 		}
 	}
 
+	/** Adds a quad to the batch, the batch is drawn first if the quad would not fit its index type */
+	void AddQuad(FSlateWindowElementList& outDrawElements, int32 layerId, const FSlateResourceHandle& resourceHandle, const FSlateRenderTransform& renderTransform, const FVector2D (&corners)[4], const FColor& color, TArray<FSlateVertex>& vertices, TArray<SlateIndex>& indices)
+	{
+		if (vertices.Num() + 4 > TNumericLimits<SlateIndex>::Max())
+		{
+			FSlateDrawElement::MakeCustomVerts(outDrawElements, layerId, resourceHandle, vertices, indices, nullptr, 0, 0);
+
+			vertices.Reset();
+			indices.Reset();
+		}
+
+		const SlateIndex firstIndex = SlateIndex(vertices.Num());
+
+		for (const FVector2D& corner : corners)
+		{
+			vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(renderTransform, FVector2f(corner), FVector2f(0.5f, 0.5f), FVector2f::UnitVector, color));
+		}
+
+		indices.Append({ firstIndex, SlateIndex(firstIndex + 1), SlateIndex(firstIndex + 2), firstIndex, SlateIndex(firstIndex + 2), SlateIndex(firstIndex + 3) });
+	}
+
 	const FString CATEGORY_DEFAULT = "Default";
 
 	FString GetCategory(const FField* field) { return field && field->HasMetaData("Category") ? field->GetMetaData("Category") : CATEGORY_DEFAULT; }
 
-	struct FRefPropInfo
+	FString FRefPropInfo::GetTopLevelName() const
 	{
-		const FString Name;
-		const FString Category;
+		int32 separatorIdx = INDEX_NONE;
 
-		FRefPropInfo(const FString& name, const FString& category = "") : Name(name), Category(category) {}
-	};
+		for (int32 charIdx = 0; charIdx < Name.Len(); charIdx++)
+		{
+			if (Name[charIdx] == '.' || Name[charIdx] == '[')
+			{
+				separatorIdx = charIdx;
+				break;
+			}
+		}
+
+		return separatorIdx == INDEX_NONE ? Name : Name.Left(separatorIdx);
+	}
 
 	bool IsChildOf(const TObjectPtr<UClass>& propertyClass, const UObject* rootAsset)
 	{
+		if (!propertyClass)
+		{
+			return false;
+		}
+
 		if (const UBlueprint* rootBlueprint = Cast<UBlueprint>(rootAsset))
 		{
-			return propertyClass->IsChildOf(rootBlueprint->GeneratedClass);
+			// Generated class is null while the blueprint is being compiled
+			return rootBlueprint->GeneratedClass && propertyClass->IsChildOf(rootBlueprint->GeneratedClass);
 		}
 		else if (const UScriptStruct* rootStruct = Cast<UScriptStruct>(rootAsset))
 		{
@@ -190,921 +283,4441 @@ namespace FRefExplorerEditorModule_PRIVATE
 		return false;
 	}
 
-	bool FindRecursive(const UStruct* uClass, const void* containerOwner, const UObject* rootAsset, TArray<FRefPropInfo>& refPropInfos, const bool isInternal)
+	bool IsChildOf(const FProperty* property, const UObject* rootAsset, const bool withContainers)
+	{
+		if (withContainers)
+		{
+			if (const FArrayProperty* arrayProperty = CastField<FArrayProperty>(property))
+			{
+				return IsChildOf(arrayProperty->Inner, rootAsset);
+			}
+			else if (const FSetProperty* setProperty = CastField<FSetProperty>(property))
+			{
+				return IsChildOf(setProperty->ElementProp, rootAsset);
+			}
+			else if (const FMapProperty* mapProperty = CastField<FMapProperty>(property))
+			{
+				return IsChildOf(mapProperty->GetKeyProperty(), rootAsset) || IsChildOf(mapProperty->GetValueProperty(), rootAsset);
+			}
+		}
+
+		return IsChildOf(property, rootAsset);
+	}
+
+	//--------------------------------------------------------------------
+	// FRefPropCollector
+	//--------------------------------------------------------------------
+
+	/** Serializes objects of the referencer once and records full property path of every reference to objects of the root package */
+	class FRefPropCollector : public FArchiveUObject
 	{
-		if (rootAsset)
+	public:
+		FRefPropCollector(const UObject* rootAsset, TArray<FRefPropInfo>& refPropInfos) : RootAsset(rootAsset), RootPackage(rootAsset->GetPackage()), RefPropInfos(refPropInfos)
+		{
+			ArIsObjectReferenceCollector = true;
+			ArIgnoreArchetypeRef = true;
+			ArIgnoreClassRef = true;
+			ArIgnoreOuterRef = true;
+		}
+
+		void Collect(UObject* refAsset)
 		{
-			for (TFieldIterator<FStructProperty> It(uClass); It; ++It)
+			RefPackage = refAsset->GetPackage();
+
+			if (RefPackage == RootPackage)
+			{
+				return;
+			}
+
+			if (UBlueprint* refBlueprint = Cast<UBlueprint>(refAsset))
 			{
-				if (const FStructProperty* structProperty = *It)
+				// Generated class is null while the blueprint is being compiled
+				if (refBlueprint->GeneratedClass)
+				{
+					Collect(refBlueprint->GeneratedClass->GetDefaultObject(), FString(), FString());
+				}
+
+				if (refBlueprint->SimpleConstructionScript)
 				{
-					if (IsChildOf(structProperty, rootAsset))
+					for (USCS_Node* scsNode : refBlueprint->SimpleConstructionScript->GetAllNodes())
 					{
-						if (isInternal)
+						if (scsNode && scsNode->ComponentTemplate)
 						{
-							return true;
+							Collect(scsNode->ComponentTemplate, scsNode->GetVariableName().ToString(), CATEGORY_COMPONENTS);
 						}
-
-						refPropInfos.Add(FRefPropInfo(structProperty->GetDisplayNameText().ToString(), GetCategory(structProperty)));
 					}
-					else
-					{
-						const void* structPropertyValue = structProperty->ContainerPtrToValuePtr<void>(containerOwner);
+				}
 
-						if (FindRecursive(structProperty->Struct, structPropertyValue, rootAsset, refPropInfos, true))
-						{
-							if (isInternal)
-							{
-								return true;
-							}
+				if (refBlueprint->InheritableComponentHandler)
+				{
+					TArray<UActorComponent*> componentTemplates;
+					refBlueprint->InheritableComponentHandler->GetAllTemplates(componentTemplates);
 
-							refPropInfos.Add(FRefPropInfo(structProperty->GetDisplayNameText().ToString(), GetCategory(structProperty)));
-						}
+					for (UActorComponent* componentTemplate : componentTemplates)
+					{
+						Collect(componentTemplate, componentTemplate->GetName(), CATEGORY_COMPONENTS);
 					}
 				}
 			}
-
-			for (TFieldIterator<FArrayProperty> It(uClass); It; ++It)
+			else if (UScriptStruct* refStruct = Cast<UScriptStruct>(refAsset))
 			{
-				if (const FArrayProperty* arrayProperty = *It)
-				{
-					const void* arrayPropertyValue = arrayProperty->ContainerPtrToValuePtr<void>(containerOwner);
+				FStructOnScope structDefault(refStruct);
 
-					if (const FObjectPropertyBase* arrayEntryProperty = CastField<FObjectPropertyBase>(arrayProperty->Inner))
-					{
-						if (IsChildOf(arrayEntryProperty, rootAsset))
-						{
-							if (isInternal)
-							{
-								return true;
-							}
+				BeginObject(refStruct, FString(), FString());
+				refStruct->SerializeItem(*this, structDefault.GetStructMemory(), nullptr);
+				EndObject();
 
-							refPropInfos.Add(FRefPropInfo(arrayProperty->GetDisplayNameText().ToString(), GetCategory(arrayProperty)));
-						}
-						else
-						{
-							const UBlueprint* rootBlueprint = Cast<UBlueprint>(rootAsset);
+				CollectPending();
+			}
+			else
+			{
+				Collect(refAsset, FString(), FString());
+			}
 
-							FScriptArrayHelper ArrayHelper(arrayProperty, arrayPropertyValue);
+			// Everything else that lives in the package, e.g. graph nodes of blueprints
+			TArray<UObject*> packageObjects;
+			GetObjectsWithPackage(RefPackage, packageObjects, true, RF_Transient);
 
-							for (int32 i = 0; i < ArrayHelper.Num(); ++i)
-							{
-								const uint8* arrayEntryPropertyValue = ArrayHelper.GetRawPtr(i);
+			for (UObject* packageObject : packageObjects)
+			{
+				if (!Visited.Contains(packageObject))
+				{
+					Collect(packageObject, packageObject->GetPathName(RefPackage), packageObject->GetClass()->GetName());
+				}
+			}
+		}
 
-								const UObject* arrayEntryObjectValue = arrayEntryProperty->GetObjectPropertyValue(arrayEntryPropertyValue);
+		// FArchive implementation
+		virtual FString GetArchiveName() const override { return TEXT("FRefPropCollector"); }
 
-								if (arrayEntryObjectValue == rootAsset || rootBlueprint && arrayEntryObjectValue == rootBlueprint->GeneratedClass)
-								{
-									if (isInternal)
-									{
-										return true;
-									}
+		virtual void PushSerializedProperty(FProperty* InProperty, const bool bIsEditorOnlyProperty) override
+		{
+			FArchiveUObject::PushSerializedProperty(InProperty, bIsEditorOnlyProperty);
 
-									refPropInfos.Add(FRefPropInfo(arrayProperty->GetDisplayNameText().ToString(), GetCategory(arrayProperty)));
-									break;
-								}
-							}
-						}
-					}
+			if (!InProperty || Frames.IsEmpty())
+			{
+				return;
+			}
 
-					if (const FStructProperty* arrayEntryProperty = CastField<FStructProperty>(arrayProperty->Inner))
-					{
-						if (IsChildOf(arrayEntryProperty, rootAsset))
-						{
-							if (isInternal)
-							{
-								return true;
-							}
+			FFrame& parent = Frames.Last();
+			FFrame frame(InProperty);
 
-							refPropInfos.Add(FRefPropInfo(arrayProperty->GetDisplayNameText().ToString(), GetCategory(arrayProperty)));
-						}
-						else
-						{
-							FScriptArrayHelper ArrayHelper(arrayProperty, arrayPropertyValue);
+			// Reference collectors serialize binary, static arrays push the property once and serialize all of its elements inside
+			frame.bStaticArray = InProperty->ArrayDim > 1;
 
-							for (int32 i = 0; i < ArrayHelper.Num(); ++i)
-							{
-								const uint8* arrayEntryPropertyValue = ArrayHelper.GetRawPtr(i);
-
-								if (FindRecursive(arrayEntryProperty->Struct, arrayEntryPropertyValue, rootAsset, refPropInfos, true))
-								{
-									if (isInternal)
-									{
-										return true;
-									}
-
-									refPropInfos.Add(FRefPropInfo(arrayProperty->GetDisplayNameText().ToString(), GetCategory(arrayProperty)));
-									break;
-								}
-							}
-						}
-					}
-				}
+			if (const FMapProperty* mapProperty = CastField<FMapProperty>(parent.Property))
+			{
+				frame.ElementKind = InProperty == mapProperty->GetKeyProperty() ? EElementKind::Key : EElementKind::Value;
+				frame.BaseIndex = frame.ElementKind == EElementKind::Key ? parent.KeyPushes++ : parent.ValuePushes++;
+			}
+			else if (CastField<FArrayProperty>(parent.Property) || CastField<FSetProperty>(parent.Property))
+			{
+				frame.ElementKind = EElementKind::Element;
+				frame.BaseIndex = parent.KeyPushes++;
 			}
 
-			for (TFieldIterator<FSetProperty> It(uClass); It; ++It)
+			// Struct elements serialize all of their members in order, so the first member marks the next element
+			if ((parent.ElementKind != EElementKind::None || parent.bStaticArray) && CastField<FStructProperty>(parent.Property))
 			{
-				if (const FSetProperty* setProperty = *It)
+				if (!parent.FirstChild)
 				{
-					const void* setPropertyValue = setProperty->ContainerPtrToValuePtr<void>(containerOwner);
+					parent.FirstChild = InProperty;
+				}
 
-					if (const FObjectPropertyBase* setEntryProperty = CastField<FObjectPropertyBase>(setProperty->ElementProp))
-					{
-						if (IsChildOf(setEntryProperty, rootAsset))
-						{
-							if (isInternal)
-							{
-								return true;
-							}
+				if (parent.FirstChild == InProperty)
+				{
+					(parent.bStaticArray ? parent.StaticIndex : parent.ElementIndex)++;
+				}
+			}
 
-							refPropInfos.Add(FRefPropInfo(setProperty->GetDisplayNameText().ToString(), GetCategory(setProperty)));
-						}
-						else
-						{
-							const UBlueprint* rootBlueprint = Cast<UBlueprint>(rootAsset);
+			Frames.Add(frame);
 
-							FScriptSetHelper SetHelper(setProperty, setPropertyValue);
+			// Properties declared with the root type reference it even with no value assigned
+			if (frame.ElementKind == EElementKind::None && IsChildOf(InProperty, RootAsset, true))
+			{
+				AddRefPropInfo(false);
+			}
+		}
 
-							for (FScriptSetHelper::FIterator setIt(SetHelper); setIt; ++setIt)
-							{
-								const uint8* setEntryPropertyValue = SetHelper.GetElementPtr(*setIt);
+		virtual void PopSerializedProperty(FProperty* InProperty, const bool bIsEditorOnlyProperty) override
+		{
+			FArchiveUObject::PopSerializedProperty(InProperty, bIsEditorOnlyProperty);
 
-								const UObject* arrayEntryObjectValue = setEntryProperty->GetObjectPropertyValue(setEntryPropertyValue);
+			if (InProperty && Frames.Num() > 1 && Frames.Last().Property == InProperty)
+			{
+				Frames.Pop(false);
+			}
+		}
 
-								if (arrayEntryObjectValue == rootAsset || rootBlueprint && arrayEntryObjectValue == rootBlueprint->GeneratedClass)
-								{
-									if (isInternal)
-									{
-										return true;
-									}
+		virtual FArchive& operator<<(UObject*& Object) override
+		{
+			CountElement();
 
-									refPropInfos.Add(FRefPropInfo(setProperty->GetDisplayNameText().ToString(), GetCategory(setProperty)));
-									break;
-								}
-							}
-						}
-					}
+			if (Object)
+			{
+				if (Object->GetPackage() == RootPackage)
+				{
+					AddRefPropInfo(false);
+				}
+				else if (Object->GetPackage() == RefPackage && !Object->HasAnyFlags(RF_Transient) && !Visited.Contains(Object))
+				{
+					Pending.Add(FPendingObject(Object, GetPath(), GetCategory()));
+				}
+			}
 
-					if (const FStructProperty* setEntryProperty = CastField<FStructProperty>(setProperty->ElementProp))
-					{
-						if (IsChildOf(setEntryProperty, rootAsset))
-						{
-							if (isInternal)
-							{
-								return true;
-							}
+			return *this;
+		}
 
-							refPropInfos.Add(FRefPropInfo(setProperty->GetDisplayNameText().ToString(), GetCategory(setProperty)));
-						}
-						else
-						{
-							FScriptSetHelper SetHelper(setProperty, setPropertyValue);
+		virtual FArchive& operator<<(FSoftObjectPath& Value) override
+		{
+			CountElement();
 
-							for (FScriptSetHelper::FIterator setIt(SetHelper); setIt; ++setIt)
-							{
-								const uint8* setEntryPropertyValue = SetHelper.GetElementPtr(*setIt);
-
-								if (FindRecursive(setEntryProperty->Struct, setEntryPropertyValue, rootAsset, refPropInfos, true))
-								{
-									if (isInternal)
-									{
-										return true;
-									}
-
-									refPropInfos.Add(FRefPropInfo(setProperty->GetDisplayNameText().ToString(), GetCategory(setProperty)));
-									break;
-								}
-							}
-						}
-					}
-				}
+			if (Value.GetLongPackageFName() == RootPackage->GetFName())
+			{
+				AddRefPropInfo(true);
 			}
 
-			for (TFieldIterator<FMapProperty> It(uClass); It; ++It)
-			{
-				if (const FMapProperty* mapProperty = *It)
-				{
-					const void* mapPropertyValue = mapProperty->ContainerPtrToValuePtr<void>(containerOwner);
+			return *this;
+		}
+		// End FArchive implementation
 
-					const FProperty* keyProperty = mapProperty->GetKeyProperty();
-					const FStructProperty* keyStructProperty = CastField<FStructProperty>(keyProperty);
-					const FObjectPropertyBase* keyObjectProperty = CastField<FObjectPropertyBase>(keyProperty);
+	private:
+		enum class EElementKind : uint8 { None, Element, Key, Value };
 
-					const FProperty* valueProperty = mapProperty->GetValueProperty();
-					const FStructProperty* valueStructProperty = CastField<FStructProperty>(valueProperty);
-					const FObjectPropertyBase* valueObjectProperty = CastField<FObjectPropertyBase>(valueProperty);
+		struct FFrame
+		{
+			FProperty* Property;
+			EElementKind ElementKind = EElementKind::None;
+			bool bStaticArray = false;
+			int32 StaticIndex = INDEX_NONE;
+			int32 BaseIndex = 0;
+			int32 ElementIndex = INDEX_NONE;
+			int32 KeyPushes = 0;
+			int32 ValuePushes = 0;
+			FProperty* FirstChild = nullptr;
+
+			FFrame(FProperty* property) : Property(property) {}
+		};
 
-					if (IsChildOf(keyProperty, rootAsset))
-					{
-						if (isInternal)
-						{
-							return true;
-						}
+		struct FPendingObject
+		{
+			UObject* Object;
+			FString Path;
+			FString Category;
 
-						refPropInfos.Add(FRefPropInfo(mapProperty->GetDisplayNameText().ToString(), GetCategory(mapProperty)));
-					}
-					else if (IsChildOf(valueProperty, rootAsset))
-					{
-						if (isInternal)
-						{
-							return true;
-						}
+			FPendingObject(UObject* object, const FString& path, const FString& category) : Object(object), Path(path), Category(category) {}
+		};
 
-						refPropInfos.Add(FRefPropInfo(mapProperty->GetDisplayNameText().ToString(), GetCategory(mapProperty)));
-					}
-					else
-					{
-						const UBlueprint* rootBlueprint = Cast<UBlueprint>(rootAsset);
+		void Collect(UObject* object, const FString& path, const FString& category)
+		{
+			Pending.Add(FPendingObject(object, path, category));
+			CollectPending();
+		}
 
-						FScriptMapHelper MapHelper(mapProperty, mapPropertyValue);
+		void CollectPending()
+		{
+			for (int32 pendingIdx = 0; pendingIdx < Pending.Num(); pendingIdx++)
+			{
+				const FPendingObject pendingObject = Pending[pendingIdx];
 
-						for (FScriptMapHelper::FIterator mapIt(MapHelper); mapIt; ++mapIt)
-						{
-							if (keyStructProperty)
-							{
-								const uint8* mapEntryPropertyValue = MapHelper.GetKeyPtr(*mapIt);
-
-								if (FindRecursive(keyStructProperty->Struct, mapEntryPropertyValue, rootAsset, refPropInfos, true))
-								{
-									if (isInternal)
-									{
-										return true;
-									}
-
-									refPropInfos.Add(FRefPropInfo(mapProperty->GetDisplayNameText().ToString(), GetCategory(mapProperty)));
-									break;
-								}
-							}
-							else if (keyObjectProperty)
-							{
-								const uint8* mapEntryPropertyValue = MapHelper.GetKeyPtr(*mapIt);
+				if (pendingObject.Object && !Visited.Contains(pendingObject.Object))
+				{
+					BeginObject(pendingObject.Object, pendingObject.Path, pendingObject.Category);
+					pendingObject.Object->Serialize(*this);
+					EndObject();
+				}
+			}
 
-								const UObject* arrayEntryObjectValue = keyObjectProperty->GetObjectPropertyValue(mapEntryPropertyValue);
+			Pending.Reset();
+		}
 
-								if (arrayEntryObjectValue == rootAsset || rootBlueprint && arrayEntryObjectValue == rootBlueprint->GeneratedClass)
-								{
-									if (isInternal)
-									{
-										return true;
-									}
+		void BeginObject(UObject* object, const FString& path, const FString& category)
+		{
+			Visited.Add(object);
 
-									refPropInfos.Add(FRefPropInfo(mapProperty->GetDisplayNameText().ToString(), GetCategory(mapProperty)));
-									break;
-								}
-							}
+			ObjectPath = path;
+			ObjectCategory = category;
 
-							if (valueStructProperty)
-							{
-								const uint8* mapEntryPropertyValue = MapHelper.GetValuePtr(*mapIt);
-
-								if (FindRecursive(valueStructProperty->Struct, mapEntryPropertyValue, rootAsset, refPropInfos, true))
-								{
-									if (isInternal)
-									{
-										return true;
-									}
-
-									refPropInfos.Add(FRefPropInfo(mapProperty->GetDisplayNameText().ToString(), GetCategory(mapProperty)));
-									break;
-								}
-							}
-							else if (valueObjectProperty)
-							{
-								const uint8* mapEntryPropertyValue = MapHelper.GetValuePtr(*mapIt);
+			Frames.Reset();
+			Frames.Add(FFrame(nullptr));
+		}
 
-								const UObject* arrayEntryObjectValue = valueObjectProperty->GetObjectPropertyValue(mapEntryPropertyValue);
+		void EndObject()
+		{
+			Frames.Reset();
+		}
 
-								if (arrayEntryObjectValue == rootAsset || rootBlueprint && arrayEntryObjectValue == rootBlueprint->GeneratedClass)
-								{
-									if (isInternal)
-									{
-										return true;
-									}
+		/** Object references of container elements and static arrays come one by one, without a property push per element */
+		void CountElement()
+		{
+			if (Frames.Num() > 1)
+			{
+				FFrame& frame = Frames.Last();
 
-									refPropInfos.Add(FRefPropInfo(mapProperty->GetDisplayNameText().ToString(), GetCategory(mapProperty)));
-									break;
-								}
-							}
-						}
+				if (CastField<FObjectPropertyBase>(frame.Property) || CastField<FInterfaceProperty>(frame.Property))
+				{
+					if (frame.ElementKind != EElementKind::None)
+					{
+						frame.ElementIndex++;
+					}
+					else if (frame.bStaticArray)
+					{
+						frame.StaticIndex++;
 					}
 				}
 			}
+		}
 
-			for (TFieldIterator<FObjectPropertyBase> It(uClass); It; ++It)
+		FString GetPath() const
+		{
+			TStringBuilder<256> path;
+			path << ObjectPath;
+
+			for (int32 frameIdx = 1; frameIdx < Frames.Num(); frameIdx++)
 			{
-				if (const FObjectPropertyBase* objectProperty = *It)
+				const FFrame& frame = Frames[frameIdx];
+
+				if (frame.ElementKind != EElementKind::None)
 				{
-					if (IsChildOf(objectProperty, rootAsset))
-					{
-						if (isInternal)
-						{
-							return true;
-						}
+					path << TEXT("[") << frame.BaseIndex + FMath::Max(frame.ElementIndex, 0) << TEXT("]");
 
-						refPropInfos.Add(FRefPropInfo(objectProperty->GetDisplayNameText().ToString(), GetCategory(objectProperty)));
+					if (frame.ElementKind == EElementKind::Key)
+					{
+						path << TEXT(".Key");
 					}
-					else
+					else if (frame.ElementKind == EElementKind::Value)
 					{
-						const UBlueprint* rootBlueprint = Cast<UBlueprint>(rootAsset);
-
-						const UObject* objectPropertyValue = objectProperty->GetObjectPropertyValue(objectProperty->ContainerPtrToValuePtr<void>(containerOwner));
+						path << TEXT(".Value");
+					}
+				}
+				else
+				{
+					if (path.Len() > 0)
+					{
+						path << TEXT(".");
+					}
 
-						if (objectPropertyValue == rootAsset || rootBlueprint && objectPropertyValue == rootBlueprint->GeneratedClass)
-						{
-							if (isInternal)
-							{
-								return true;
-							}
+					path << frame.Property->GetAuthoredName();
 
-							refPropInfos.Add(FRefPropInfo(objectProperty->GetDisplayNameText().ToString(), GetCategory(objectProperty)));
-						}
+					if (frame.bStaticArray)
+					{
+						path << TEXT("[") << FMath::Max(frame.StaticIndex, 0) << TEXT("]");
 					}
 				}
 			}
+
+			return path.ToString();
 		}
 
-		return false;
-	}
-}
-//--------------------------------------------------------------------
-// FRefExplorerCommands
-//--------------------------------------------------------------------
+		FString GetCategory() const
+		{
+			if (!ObjectCategory.IsEmpty())
+			{
+				return ObjectCategory;
+			}
 
-class FRefExplorerCommands : public TCommands<FRefExplorerCommands>
-{
-public:
-	FRefExplorerCommands() : TCommands<FRefExplorerCommands>(
-		"RefExplorerCommands", NSLOCTEXT("Contexts", "RefExplorerCommands", "Ref Explorer"),
-		NAME_None, FAppStyle::GetAppStyleSetName())
-	{}
+			return Frames.Num() > 1 ? FRefExplorerEditorModule_PRIVATE::GetCategory(Frames[1].Property) : CATEGORY_DEFAULT;
+		}
 
-	// TCommands<> interface
-	virtual void RegisterCommands() override
-	{
-		UI_COMMAND(OpenSelectedInAssetEditor, "Edit...", "Opens the selected asset in the relevant editor.", EUserInterfaceActionType::Button, FInputChord(EModifierKey::Control, EKeys::E));
-		UI_COMMAND(ZoomToFit, "Zoom to Fit", "Zoom in and center the view on the selected item", EUserInterfaceActionType::Button, FInputChord(EKeys::F));
+		void AddRefPropInfo(const bool isSoft)
+		{
+			const FString path = GetPath();
 
-		UI_COMMAND(CopyReferencedObjects, "Copy Referenced Objects List", "Copies the list of objects that the selected asset references to the clipboard.", EUserInterfaceActionType::Button, FInputChord());
-		UI_COMMAND(CopyReferencingObjects, "Copy Referencing Objects List", "Copies the list of objects that reference the selected asset to the clipboard.", EUserInterfaceActionType::Button, FInputChord());
-		UI_COMMAND(ShowReferencedObjects, "Show Referenced Objects List", "Shows a list of objects that the selected asset references.", EUserInterfaceActionType::Button, FInputChord());
-		UI_COMMAND(ShowReferencingObjects, "Show Referencing Objects List", "Shows a list of objects that reference the selected asset.", EUserInterfaceActionType::Button, FInputChord());
-		UI_COMMAND(ShowReferenceTree, "Show Reference Tree", "Shows a reference tree for the selected asset.", EUserInterfaceActionType::Button, FInputChord());
-	}
-	// End of TCommands<> interface
+			if (path.IsEmpty())
+			{
+				return;
+			}
 
-	// Opens the selected asset in the asset editor
-	TSharedPtr<FUICommandInfo> OpenSelectedInAssetEditor;
+			const FString category = GetCategory();
 
-	// Copies the list of objects that the selected asset references
-	TSharedPtr<FUICommandInfo> CopyReferencedObjects;
+			if (!RefPropInfos.ContainsByPredicate([&](const FRefPropInfo& refPropInfo) { return refPropInfo.Name == path && refPropInfo.Category == category; }))
+			{
+				RefPropInfos.Add(FRefPropInfo(path, category, isSoft));
+			}
+		}
 
-	// Copies the list of objects that reference the selected asset
-	TSharedPtr<FUICommandInfo> CopyReferencingObjects;
+	private:
+		const UObject* RootAsset;
+		const UPackage* RootPackage;
+		const UPackage* RefPackage = nullptr;
+		TArray<FRefPropInfo>& RefPropInfos;
+
+		TSet<const UObject*> Visited;
+		TArray<FPendingObject> Pending;
+
+		FString ObjectPath;
+		FString ObjectCategory;
+		TArray<FFrame> Frames;
+
+		static constexpr const TCHAR* CATEGORY_COMPONENTS = TEXT("Components");
+	};
+
+	//--------------------------------------------------------------------
+	// FPackageReferenceCollector
+	//--------------------------------------------------------------------
+
+	/** Collects names of packages referenced by objects of a package in memory */
+	class FPackageReferenceCollector : public FArchiveUObject
+	{
+	public:
+		FPackageReferenceCollector(const UPackage* package, TSet<FName>& packageNames) : Package(package), PackageNames(packageNames)
+		{
+			ArIsObjectReferenceCollector = true;
+			ArIgnoreOuterRef = true;
+		}
+
+		void Collect(UObject* object) { object->Serialize(*this); }
+
+		virtual FArchive& operator<<(UObject*& Object) override
+		{
+			if (Object)
+			{
+				AddPackageName(Object->GetPackage());
+			}
+
+			return *this;
+		}
+
+		virtual FArchive& operator<<(FSoftObjectPath& Value) override
+		{
+			const FName packageName = Value.GetLongPackageFName();
+
+			if (!packageName.IsNone() && packageName != Package->GetFName())
+			{
+				PackageNames.Add(packageName);
+			}
+
+			return *this;
+		}
+
+	protected:
+		void AddPackageName(const UPackage* package)
+		{
+			if (package && package != Package && !package->HasAnyPackageFlags(PKG_CompiledIn) && package != GetTransientPackage())
+			{
+				PackageNames.Add(package->GetFName());
+			}
+		}
+
+		const UPackage* Package;
+		TSet<FName>& PackageNames;
+	};
+
+	//--------------------------------------------------------------------
+	// FPackagePropertyReader
+	//--------------------------------------------------------------------
+
+	/** Finds properties referencing the root by reading tagged property streams of package exports straight from the package file, no UObjects are created */
+	class FPackagePropertyReader
+	{
+	public:
+		FPackagePropertyReader(const FName rootPackageName, const TSet<FName>& nativeStructNames, TArray<FRefPropInfo>& refPropInfos) : RootPackageName(rootPackageName), NativeStructNames(nativeStructNames), RefPropInfos(refPropInfos) {}
+
+		/** Gets names of structs serialized by their own code instead of as tagged properties. Must be called on the game thread, the result is then safe to share with readers */
+		static TSet<FName> GetNativeStructNames()
+		{
+			check(IsInGameThread());
+
+			TSet<FName> nativeStructNames;
+
+			for (TObjectIterator<UScriptStruct> It; It; ++It)
+			{
+				if (It->UseNativeSerialization() || (It->StructFlags & STRUCT_Immutable) != 0)
+				{
+					nativeStructNames.Add(It->GetFName());
+				}
+			}
+
+			return nativeStructNames;
+		}
+
+		bool Read(const FName referencerPackageName)
+		{
+			FString packageFilename;
+			if (!FPackageName::DoesPackageExist(referencerPackageName.ToString(), &packageFilename))
+			{
+				return false;
+			}
+
+			if (!Reader.OpenPackageFile(referencerPackageName.ToString(), packageFilename))
+			{
+				return false;
+			}
+
+			TArray<FObjectImport> importMap;
+			TArray<FObjectExport> exportMap;
+
+			if (!Reader.SerializeNameMap() || !Reader.SerializeImportMap(importMap) || !Reader.SerializeExportMap(exportMap))
+			{
+				return false;
+			}
+
+			RootImports.Init(false, importMap.Num());
+
+			for (int32 importIdx = 0; importIdx < importMap.Num(); importIdx++)
+			{
+				int32 outermostIdx = importIdx;
+
+				for (int32 depth = 0; depth < importMap.Num() && importMap[outermostIdx].OuterIndex.IsImport(); depth++)
+				{
+					outermostIdx = importMap[outermostIdx].OuterIndex.ToImport();
+				}
+
+				RootImports[importIdx] = importMap[outermostIdx].ObjectName == RootPackageName;
+			}
+
+			if (!ReadSoftObjectPathList())
+			{
+				return false;
+			}
+
+			for (const FObjectExport& objectExport : exportMap)
+			{
+				// Exports of UClass itself start with native data instead of tagged properties
+				if (objectExport.ClassIndex.IsNull() || objectExport.SerialSize <= 0)
+				{
+					continue;
+				}
+
+				const FString exportName = objectExport.ObjectName.ToString();
+				Category = exportName.StartsWith(DEFAULT_OBJECT_PREFIX) ? CATEGORY_DEFAULT : exportName;
+
+				Reader.Seek(objectExport.SerialOffset);
+				ReadTaggedProperties(objectExport.SerialOffset + objectExport.SerialSize, FString());
+				Reader.ClearError();
+			}
+
+			return true;
+		}
+
+	private:
+		/** Reads tags up to the terminating None, returns false at the first invalid tag (and so nothing after it can be trusted) */
+		bool ReadTaggedProperties(const int64 endOffset, const FString& pathPrefix)
+		{
+			while (Reader.Tell() < endOffset)
+			{
+				FPropertyTag tag;
+				Reader << tag;
+
+				if (Reader.IsError())
+				{
+					return false;
+				}
+
+				if (tag.Name.IsNone())
+				{
+					return true;
+				}
+
+				if (tag.Type.IsNone() || tag.Size < 0 || tag.ArrayIndex < 0 || Reader.Tell() + tag.Size > endOffset)
+				{
+					return false;
+				}
+
+				const int64 valueOffset = Reader.Tell();
+
+				FString path = pathPrefix + GetAuthoredName(tag.Name);
+				if (tag.ArrayIndex > 0)
+				{
+					path += FString::Printf(TEXT("[%d]"), tag.ArrayIndex);
+				}
+
+				if (tag.Type == NAME_ArrayProperty)
+				{
+					ReadArray(tag.InnerType, valueOffset + tag.Size, path);
+				}
+				else if (tag.Type == NAME_SetProperty)
+				{
+					ReadSet(tag.InnerType, valueOffset + tag.Size, path);
+				}
+				else if (tag.Type == NAME_MapProperty)
+				{
+					ReadMap(tag.InnerType, tag.ValueType, valueOffset + tag.Size, path);
+				}
+				else
+				{
+					ReadElement(tag.Type, tag.StructName, valueOffset + tag.Size, path);
+				}
+
+				// Value was either fully read or is unreadable, tag size tells where the next one starts anyway
+				Reader.ClearError();
+				Reader.Seek(valueOffset + tag.Size);
+			}
+
+			return false;
+		}
+
+		void ReadArray(const FName innerType, const int64 endOffset, const FString& path)
+		{
+			int32 num = 0;
+			Reader << num;
+
+			FName structName = NAME_None;
+
+			if (innerType == NAME_StructProperty)
+			{
+				FPropertyTag innerTag;
+				Reader << innerTag;
+
+				if (Reader.IsError() || innerTag.Type != NAME_StructProperty)
+				{
+					return;
+				}
+
+				structName = innerTag.StructName;
+			}
+
+			for (int32 i = 0; i < num && !Reader.IsError() && Reader.Tell() < endOffset; i++)
+			{
+				if (!ReadElement(innerType, structName, endOffset, FString::Printf(TEXT("%s[%d]"), *path, i)))
+				{
+					break;
+				}
+			}
+		}
+
+		void ReadSet(const FName elementType, const int64 endOffset, const FString& path)
+		{
+			int32 numToRemove = 0;
+			Reader << numToRemove;
+
+			for (int32 i = 0; i < numToRemove && !Reader.IsError() && Reader.Tell() < endOffset; i++)
+			{
+				if (!ReadElement(elementType, NAME_None, endOffset, FString()))
+				{
+					return;
+				}
+			}
+
+			int32 num = 0;
+			Reader << num;
+
+			for (int32 i = 0; i < num && !Reader.IsError() && Reader.Tell() < endOffset; i++)
+			{
+				if (!ReadElement(elementType, NAME_None, endOffset, FString::Printf(TEXT("%s[%d]"), *path, i)))
+				{
+					return;
+				}
+			}
+		}
+
+		void ReadMap(const FName keyType, const FName valueType, const int64 endOffset, const FString& path)
+		{
+			int32 numToRemove = 0;
+			Reader << numToRemove;
+
+			for (int32 i = 0; i < numToRemove && !Reader.IsError() && Reader.Tell() < endOffset; i++)
+			{
+				if (!ReadElement(keyType, NAME_None, endOffset, FString()))
+				{
+					return;
+				}
+			}
+
+			int32 num = 0;
+			Reader << num;
+
+			for (int32 i = 0; i < num && !Reader.IsError() && Reader.Tell() < endOffset; i++)
+			{
+				if (!ReadElement(keyType, NAME_None, endOffset, FString::Printf(TEXT("%s[%d].Key"), *path, i)) ||
+					!ReadElement(valueType, NAME_None, endOffset, FString::Printf(TEXT("%s[%d].Value"), *path, i)))
+				{
+					return;
+				}
+			}
+		}
+
+		/** Reads single value of the given type, returns false if the value can't be read (and so neither can anything after it) */
+		bool ReadElement(const FName type, const FName structName, const int64 endOffset, const FString& path)
+		{
+			if (type == NAME_ObjectProperty || type == NAME_ClassProperty || type == NAME_InterfaceProperty || type == NAME_WeakObjectProperty)
+			{
+				FPackageIndex index;
+				Reader << index;
+
+				if (index.IsImport() && RootImports.IsValidIndex(index.ToImport()) && RootImports[index.ToImport()])
+				{
+					AddRefPropInfo(path, false);
+				}
+			}
+			else if (type == NAME_SoftObjectProperty || type == NAME_SoftClassProperty || structName == NAME_SoftObjectPath || structName == NAME_SoftClassPath)
+			{
+				FName packageName;
+				if (!ReadSoftObjectPackageName(packageName))
+				{
+					return false;
+				}
+
+				if (packageName == RootPackageName)
+				{
+					AddRefPropInfo(path, true);
+				}
+			}
+			else if (type == NAME_StructProperty)
+			{
+				// Natively serialized structs can't hold references we are able to find here
+				if (structName.IsNone() || NativeStructNames.Contains(structName))
+				{
+					return false;
+				}
+
+				if (!ReadTaggedProperties(endOffset, path.IsEmpty() ? path : path + TEXT(".")))
+				{
+					return false;
+				}
+			}
+			else if (type == NAME_NameProperty)
+			{
+				FName name;
+				Reader << name;
+			}
+			else if (type == NAME_StrProperty)
+			{
+				FString str;
+				Reader << str;
+			}
+			else if (type == NAME_IntProperty || type == NAME_UInt32Property || type == NAME_FloatProperty)
+			{
+				Reader.Seek(Reader.Tell() + sizeof(int32));
+			}
+			else if (type == NAME_Int64Property || type == NAME_UInt64Property || type == NAME_DoubleProperty)
+			{
+				Reader.Seek(Reader.Tell() + sizeof(int64));
+			}
+			else
+			{
+				return false;
+			}
+
+			return !Reader.IsError();
+		}
+
+		bool ReadSoftObjectPathList()
+		{
+			const FPackageFileSummary& summary = Reader.GetPackageFileSummary();
+
+			if (summary.SoftObjectPathsCount <= 0)
+			{
+				return true;
+			}
+
+			Reader.Seek(summary.SoftObjectPathsOffset);
+
+			SoftObjectPackageNames.Reserve(summary.SoftObjectPathsCount);
+
+			for (int32 i = 0; i < summary.SoftObjectPathsCount; i++)
+			{
+				FName packageName;
+				if (!ReadInlineSoftObjectPackageName(packageName))
+				{
+					return false;
+				}
+
+				SoftObjectPackageNames.Add(packageName);
+			}
+
+			return true;
+		}
+
+		bool ReadSoftObjectPackageName(FName& outPackageName)
+		{
+			if (SoftObjectPackageNames.IsEmpty())
+			{
+				return ReadInlineSoftObjectPackageName(outPackageName);
+			}
+
+			int32 index = INDEX_NONE;
+			Reader << index;
+
+			if (!SoftObjectPackageNames.IsValidIndex(index))
+			{
+				return false;
+			}
+
+			outPackageName = SoftObjectPackageNames[index];
+			return true;
+		}
+
+		bool ReadInlineSoftObjectPackageName(FName& outPackageName)
+		{
+			FString subPath;
+
+			if (Reader.UEVer() >= EUnrealEngineObjectUE5Version::FSOFTOBJECTPATH_REMOVE_ASSET_PATH_FNAMES)
+			{
+				FName assetName;
+				Reader << outPackageName << assetName << subPath;
+			}
+			else
+			{
+				FName assetPathName;
+				Reader << assetPathName << subPath;
+
+				outPackageName = FName(*FPackageName::ObjectPathToPackageName(assetPathName.ToString()));
+			}
+
+			return !Reader.IsError();
+		}
+
+		void AddRefPropInfo(const FString& path, const bool isSoft)
+		{
+			if (!path.IsEmpty() && !RefPropInfos.ContainsByPredicate([&](const FRefPropInfo& refPropInfo) { return refPropInfo.Name == path && refPropInfo.Category == Category; }))
+			{
+				RefPropInfos.Add(FRefPropInfo(path, Category, isSoft));
+			}
+		}
+
+		/** User defined struct members are saved as Name_Index_Guid */
+		static FString GetAuthoredName(const FName name)
+		{
+			FString authoredName = name.ToString();
+
+			int32 guidSeparator;
+			if (authoredName.FindLastChar('_', guidSeparator) && authoredName.Len() - guidSeparator - 1 == 32)
+			{
+				int32 indexSeparator;
+				if (authoredName.Left(guidSeparator).FindLastChar('_', indexSeparator) && indexSeparator > 0)
+				{
+					authoredName.LeftInline(indexSeparator);
+				}
+			}
+
+			return authoredName;
+		}
+
+	private:
+		const FName RootPackageName;
+		const TSet<FName>& NativeStructNames;
+		TArray<FRefPropInfo>& RefPropInfos;
+
+		FPackageReader Reader;
+		TBitArray<> RootImports;
+		TArray<FName> SoftObjectPackageNames;
+		FString Category;
+
+		static constexpr const TCHAR* DEFAULT_OBJECT_PREFIX = TEXT("Default__");
+	};
+
+	//--------------------------------------------------------------------
+	// FLayoutGraph
+	//--------------------------------------------------------------------
+
+	/** Plain copy of the node info graph, so layouts can be computed on worker threads. Node 0 is the root */
+	struct FLayoutGraph
+	{
+		TArray<TArray<int32>> Children;
+		TArray<FVector2D> Positions;
+
+		int32 AddNode()
+		{
+			Positions.AddZeroed();
+			return Children.AddDefaulted();
+		}
+
+		FORCEINLINE int32 Num() const { return Children.Num(); }
+	};
+
+	const float LAYOUT_LAYER_SPACING = 480.f;
+	const float LAYOUT_COLUMN_SPACING = 320.f;
+	const float LAYOUT_ROW_SPACING = 200.f;
+
+	/** Size of a node with a thumbnail, used until its widget is arranged */
+	const FVector2D LAYOUT_NODE_SIZE(240.f, 180.f);
+	const float LAYOUT_NODE_MARGIN = 16.f;
+
+	/** Bumped when the layout cache file format or the layouts change */
+	const int32 LAYOUT_CACHE_VERSION = 1;
+
+	/** Layout cache files are read and written on worker threads, explorers with the same root share a file */
+	FCriticalSection LayoutCacheFileLock;
+
+	/**
+	 * Sugiyama-style layout: nodes are ranked by distance from the root, ranks are ordered by barycenters to reduce crossings,
+	 * and every rank is placed in columns to the left of the previous one. Ranks too tall for one column are wrapped into a block
+	 */
+	void ComputeLayeredLayout(FLayoutGraph& layoutGraph)
+	{
+		const int32 numNodes = layoutGraph.Num();
+
+		if (numNodes == 0)
+		{
+			return;
+		}
+
+		// Rank assignment, breadth first so the initial order within ranks follows the sorted links
+
+		TArray<int32> ranks;
+		ranks.Init(INDEX_NONE, numNodes);
+
+		TArray<int32> queue;
+		queue.Reserve(numNodes);
+
+		ranks[0] = 0;
+		queue.Add(0);
+
+		for (int32 queueIdx = 0; queueIdx < queue.Num(); queueIdx++)
+		{
+			const int32 nodeIdx = queue[queueIdx];
+
+			for (const int32 childIdx : layoutGraph.Children[nodeIdx])
+			{
+				if (ranks[childIdx] == INDEX_NONE)
+				{
+					ranks[childIdx] = ranks[nodeIdx] + 1;
+					queue.Add(childIdx);
+				}
+			}
+		}
+
+		const int32 lastRank = ranks[queue.Last()];
+
+		for (int32 nodeIdx = 0; nodeIdx < numNodes; nodeIdx++)
+		{
+			if (ranks[nodeIdx] == INDEX_NONE)
+			{
+				ranks[nodeIdx] = lastRank + 1;
+				queue.Add(nodeIdx);
+			}
+		}
+
+		// Layers, long edges are split with dummy nodes so they take part in crossing reduction
+
+		TArray<TArray<int32>> layers;
+		layers.SetNum(ranks[queue.Last()] + 1);
+
+		for (const int32 nodeIdx : queue)
+		{
+			layers[ranks[nodeIdx]].Add(nodeIdx);
+		}
+
+		TArray<TArray<int32>> upper;
+		TArray<TArray<int32>> lower;
+		upper.SetNum(numNodes);
+		lower.SetNum(numNodes);
+
+		for (int32 nodeIdx = 0; nodeIdx < numNodes; nodeIdx++)
+		{
+			for (const int32 childIdx : layoutGraph.Children[nodeIdx])
+			{
+				// Edges inside a rank or back to a previous rank are left out of ordering
+				if (ranks[childIdx] <= ranks[nodeIdx])
+				{
+					continue;
+				}
+
+				int32 prevIdx = nodeIdx;
+
+				for (int32 rank = ranks[nodeIdx] + 1; rank < ranks[childIdx]; rank++)
+				{
+					const int32 dummyIdx = upper.AddDefaulted();
+					lower.AddDefaulted();
+					ranks.Add(rank);
+					layers[rank].Add(dummyIdx);
+
+					lower[prevIdx].Add(dummyIdx);
+					upper[dummyIdx].Add(prevIdx);
+					prevIdx = dummyIdx;
+				}
+
+				lower[prevIdx].Add(childIdx);
+				upper[childIdx].Add(prevIdx);
+			}
+		}
+
+		// Crossing reduction, alternating sweeps towards and away from the root
+
+		TArray<float> orders;
+		orders.SetNumUninitialized(ranks.Num());
+
+		for (const TArray<int32>& layer : layers)
+		{
+			for (int32 orderIdx = 0; orderIdx < layer.Num(); orderIdx++)
+			{
+				orders[layer[orderIdx]] = orderIdx;
+			}
+		}
+
+		TArray<float> keys;
+		keys.SetNumUninitialized(ranks.Num());
+
+		for (int32 sweepIdx = 0; sweepIdx < 8; sweepIdx++)
+		{
+			const bool bAwayFromRoot = sweepIdx % 2 == 0;
+
+			for (int32 step = 1; step < layers.Num(); step++)
+			{
+				TArray<int32>& layer = layers[bAwayFromRoot ? step : layers.Num() - 1 - step];
+				const TArray<TArray<int32>>& neighbours = bAwayFromRoot ? upper : lower;
+
+				for (const int32 nodeIdx : layer)
+				{
+					float sum = 0.f;
+
+					for (const int32 neighbourIdx : neighbours[nodeIdx])
+					{
+						sum += orders[neighbourIdx];
+					}
+
+					keys[nodeIdx] = neighbours[nodeIdx].IsEmpty() ? orders[nodeIdx] : sum / neighbours[nodeIdx].Num();
+				}
+
+				Algo::StableSortBy(layer, [&keys](const int32 nodeIdx) { return keys[nodeIdx]; });
+
+				for (int32 orderIdx = 0; orderIdx < layer.Num(); orderIdx++)
+				{
+					orders[layer[orderIdx]] = orderIdx;
+				}
+			}
+		}
+
+		// Coordinate assignment
+
+		TArray<FVector2D> positions;
+		positions.SetNumZeroed(ranks.Num());
+
+		float layerX = 0.f;
+
+		for (int32 rank = 1; rank < layers.Num(); rank++)
+		{
+			const TArray<int32>& layer = layers[rank];
+
+			if (layer.IsEmpty())
+			{
+				continue;
+			}
+
+			layerX += LAYOUT_LAYER_SPACING;
+
+			const int32 maxRows = FMath::Max(12, FMath::CeilToInt(FMath::Sqrt(layer.Num() * LAYOUT_COLUMN_SPACING / LAYOUT_ROW_SPACING)));
+
+			if (layer.Num() <= maxRows)
+			{
+				// Single column, nodes are pulled towards their parents and pushed apart while keeping the order
+				TArray<float> desiredYs;
+				desiredYs.SetNumUninitialized(layer.Num());
+
+				for (int32 orderIdx = 0; orderIdx < layer.Num(); orderIdx++)
+				{
+					const TArray<int32>& parents = upper[layer[orderIdx]];
+
+					float sum = 0.f;
+
+					for (const int32 parentIdx : parents)
+					{
+						sum += positions[parentIdx].Y;
+					}
+
+					desiredYs[orderIdx] = parents.IsEmpty() ? 0.f : sum / parents.Num();
+				}
+
+				float shift = 0.f;
+				float prevY = -UE_BIG_NUMBER;
+
+				for (int32 orderIdx = 0; orderIdx < layer.Num(); orderIdx++)
+				{
+					prevY = FMath::Max(desiredYs[orderIdx], prevY + LAYOUT_ROW_SPACING);
+					positions[layer[orderIdx]] = FVector2D(-layerX, prevY);
+					shift += prevY - desiredYs[orderIdx];
+				}
+
+				shift /= layer.Num();
+
+				for (const int32 nodeIdx : layer)
+				{
+					positions[nodeIdx].Y -= shift;
+				}
+			}
+			else
+			{
+				// Block of columns centered on the root row
+				const int32 numColumns = FMath::DivideAndRoundUp(layer.Num(), maxRows);
+
+				for (int32 orderIdx = 0; orderIdx < layer.Num(); orderIdx++)
+				{
+					const int32 columnIdx = orderIdx / maxRows;
+					const int32 rowIdx = orderIdx % maxRows;
+					const int32 numRows = FMath::Min(maxRows, layer.Num() - columnIdx * maxRows);
+
+					positions[layer[orderIdx]] = FVector2D(-(layerX + columnIdx * LAYOUT_COLUMN_SPACING), (rowIdx - (numRows - 1) * 0.5f) * LAYOUT_ROW_SPACING);
+				}
+
+				layerX += (numColumns - 1) * LAYOUT_COLUMN_SPACING;
+			}
+		}
+
+		for (int32 nodeIdx = 0; nodeIdx < numNodes; nodeIdx++)
+		{
+			layoutGraph.Positions[nodeIdx] = positions[nodeIdx];
+		}
+	}
+
+	//--------------------------------------------------------------------
+	// FBarnesHutTree
+	//--------------------------------------------------------------------
+
+	/** Quadtree over node positions, distant cells repel as a single body at their center of mass */
+	class FBarnesHutTree
+	{
+	public:
+		void Build(const float* xs, const float* ys, const int32 num)
+		{
+			Xs = xs;
+			Ys = ys;
+
+			FVector2f minBounds(UE_BIG_NUMBER);
+			FVector2f maxBounds(-UE_BIG_NUMBER);
+
+			for (int32 bodyIdx = 0; bodyIdx < num; bodyIdx++)
+			{
+				minBounds = minBounds.ComponentMin(FVector2f(xs[bodyIdx], ys[bodyIdx]));
+				maxBounds = maxBounds.ComponentMax(FVector2f(xs[bodyIdx], ys[bodyIdx]));
+			}
+
+			Cells.Reset(num * 2);
+			AddCell((minBounds + maxBounds) * 0.5f, FMath::Max(FMath::Max(maxBounds.X - minBounds.X, maxBounds.Y - minBounds.Y) * 0.5f, 1.f) + 1.f);
+
+			for (int32 bodyIdx = 0; bodyIdx < num; bodyIdx++)
+			{
+				Insert(bodyIdx);
+			}
+		}
+
+		/** Sums Fruchterman-Reingold repulsion k^2 / d from all other bodies */
+		FVector2f GetRepulsion(const int32 bodyIdx, const float kSquared, const float thetaSquared) const
+		{
+			const FVector2f position(Xs[bodyIdx], Ys[bodyIdx]);
+			FVector2f force(0.f);
+
+			TArray<int32, TInlineAllocator<64>> stack;
+			stack.Add(0);
+
+			while (!stack.IsEmpty())
+			{
+				const FCell& cell = Cells[stack.Pop(false)];
+
+				float mass = cell.Mass;
+
+				if (cell.IsLeaf() && cell.Body == bodyIdx)
+				{
+					mass -= 1.f;
+				}
+
+				if (mass <= 0.f)
+				{
+					continue;
+				}
+
+				const FVector2f delta = position - cell.MassCenter;
+				const float distSquared = FMath::Max(delta.SizeSquared(), 1.f);
+
+				if (cell.IsLeaf() || 4.f * cell.HalfSize * cell.HalfSize < thetaSquared * distSquared)
+				{
+					force += delta * (kSquared * mass / distSquared);
+				}
+				else
+				{
+					stack.Append(cell.Children, 4);
+				}
+			}
+
+			return force;
+		}
+
+	private:
+		struct FCell
+		{
+			FVector2f Center;
+			float HalfSize;
+			FVector2f MassCenter;
+			float Mass;
+			int32 Body;
+			int32 Children[4];
+
+			FORCEINLINE bool IsLeaf() const { return Children[0] == INDEX_NONE; }
+		};
+
+		int32 AddCell(const FVector2f& center, const float halfSize)
+		{
+			FCell cell;
+			cell.Center = center;
+			cell.HalfSize = halfSize;
+			cell.MassCenter = FVector2f(0.f);
+			cell.Mass = 0.f;
+			cell.Body = INDEX_NONE;
+			cell.Children[0] = cell.Children[1] = cell.Children[2] = cell.Children[3] = INDEX_NONE;
+
+			return Cells.Add(cell);
+		}
+
+		int32 GetQuadrant(const FCell& cell, const FVector2f& position) const
+		{
+			return (position.X >= cell.Center.X ? 1 : 0) + (position.Y >= cell.Center.Y ? 2 : 0);
+		}
+
+		void Insert(const int32 bodyIdx)
+		{
+			const FVector2f position(Xs[bodyIdx], Ys[bodyIdx]);
+
+			int32 cellIdx = 0;
+
+			for (int32 depth = 0; ; depth++)
+			{
+				{
+					FCell& cell = Cells[cellIdx];
+					cell.MassCenter = (cell.MassCenter * cell.Mass + position) / (cell.Mass + 1.f);
+					cell.Mass += 1.f;
+
+					if (cell.IsLeaf())
+					{
+						// Empty leaf, or too deep to split bodies sitting on top of each other
+						if (cell.Body == INDEX_NONE || depth >= MAX_DEPTH)
+						{
+							cell.Body = cell.Body == INDEX_NONE ? bodyIdx : cell.Body;
+							return;
+						}
+					}
+				}
+
+				if (Cells[cellIdx].IsLeaf())
+				{
+					const FVector2f center = Cells[cellIdx].Center;
+					const float childHalfSize = Cells[cellIdx].HalfSize * 0.5f;
+
+					for (int32 quadrant = 0; quadrant < 4; quadrant++)
+					{
+						const FVector2f offset((quadrant & 1) ? childHalfSize : -childHalfSize, (quadrant & 2) ? childHalfSize : -childHalfSize);
+						const int32 childIdx = AddCell(center + offset, childHalfSize);
+						Cells[cellIdx].Children[quadrant] = childIdx;
+					}
+
+					// Push the body already in here one level down
+					const int32 movedBodyIdx = Cells[cellIdx].Body;
+					Cells[cellIdx].Body = INDEX_NONE;
+
+					FCell& movedCell = Cells[Cells[cellIdx].Children[GetQuadrant(Cells[cellIdx], FVector2f(Xs[movedBodyIdx], Ys[movedBodyIdx]))]];
+					movedCell.Body = movedBodyIdx;
+					movedCell.Mass = 1.f;
+					movedCell.MassCenter = FVector2f(Xs[movedBodyIdx], Ys[movedBodyIdx]);
+				}
+
+				cellIdx = Cells[cellIdx].Children[GetQuadrant(Cells[cellIdx], position)];
+			}
+		}
+
+		static constexpr int32 MAX_DEPTH = 24;
+
+		TArray<FCell> Cells;
+		const float* Xs = nullptr;
+		const float* Ys = nullptr;
+	};
+
+	/**
+	 * Refines positions with Fruchterman-Reingold forces: Barnes-Hut repulsion in parallel, springs along links,
+	 * and temperature limited displacement integrated four nodes at a time. The root stays pinned at the origin
+	 */
+	void ComputeForceDirectedLayout(FLayoutGraph& layoutGraph, const std::atomic<bool>& cancelled, TFunctionRef<void(const FLayoutGraph&)> onProgress)
+	{
+		const int32 numNodes = layoutGraph.Num();
+
+		if (numNodes < 2)
+		{
+			return;
+		}
+
+		const float k = LAYOUT_COLUMN_SPACING;
+		const float kSquared = k * k;
+		const float thetaSquared = 0.9f * 0.9f;
+		const int32 maxIterations = 400;
+		const double progressInterval = 0.1;
+
+		// Padded to whole vector registers, padding lanes get zero forces
+		const int32 numPadded = FMath::DivideAndRoundUp(numNodes, 4) * 4;
+
+		TArray<float> xs, ys, fxs, fys;
+		xs.SetNumZeroed(numPadded);
+		ys.SetNumZeroed(numPadded);
+		fxs.SetNumZeroed(numPadded);
+		fys.SetNumZeroed(numPadded);
+
+		for (int32 nodeIdx = 0; nodeIdx < numNodes; nodeIdx++)
+		{
+			xs[nodeIdx] = layoutGraph.Positions[nodeIdx].X;
+			ys[nodeIdx] = layoutGraph.Positions[nodeIdx].Y;
+		}
+
+		FBarnesHutTree tree;
+		double lastProgressTime = FPlatformTime::Seconds();
+
+		for (int32 iteration = 0; iteration < maxIterations && !cancelled; iteration++)
+		{
+			tree.Build(xs.GetData(), ys.GetData(), numNodes);
+
+			ParallelFor(numNodes, [&](int32 nodeIdx)
+				{
+					const FVector2f force = tree.GetRepulsion(nodeIdx, kSquared, thetaSquared);
+					fxs[nodeIdx] = force.X;
+					fys[nodeIdx] = force.Y;
+				});
+
+			for (int32 nodeIdx = 0; nodeIdx < numNodes; nodeIdx++)
+			{
+				for (const int32 childIdx : layoutGraph.Children[nodeIdx])
+				{
+					const float dx = xs[childIdx] - xs[nodeIdx];
+					const float dy = ys[childIdx] - ys[nodeIdx];
+					const float scale = FMath::Sqrt(dx * dx + dy * dy) / k;
+
+					fxs[nodeIdx] += dx * scale;
+					fys[nodeIdx] += dy * scale;
+					fxs[childIdx] -= dx * scale;
+					fys[childIdx] -= dy * scale;
+				}
+			}
+
+			fxs[0] = 0.f;
+			fys[0] = 0.f;
+
+			// Cooling schedule
+			const float temperature = FMath::Max(k * (1.f - (float)iteration / maxIterations), 1.f);
+
+			const VectorRegister4Float temperatureVec = VectorSetFloat1(temperature);
+			const VectorRegister4Float epsilonVec = VectorSetFloat1(UE_SMALL_NUMBER);
+			VectorRegister4Float displacementVec = VectorZeroFloat();
+
+			for (int32 nodeIdx = 0; nodeIdx < numPadded; nodeIdx += 4)
+			{
+				const VectorRegister4Float fx = VectorLoad(&fxs[nodeIdx]);
+				const VectorRegister4Float fy = VectorLoad(&fys[nodeIdx]);
+
+				const VectorRegister4Float lengthSquared = VectorMultiplyAdd(fx, fx, VectorMultiplyAdd(fy, fy, epsilonVec));
+				const VectorRegister4Float invLength = VectorReciprocalSqrt(lengthSquared);
+				const VectorRegister4Float displacement = VectorMin(VectorMultiply(lengthSquared, invLength), temperatureVec);
+				const VectorRegister4Float scale = VectorMultiply(displacement, invLength);
+
+				VectorStore(VectorMultiplyAdd(fx, scale, VectorLoad(&xs[nodeIdx])), &xs[nodeIdx]);
+				VectorStore(VectorMultiplyAdd(fy, scale, VectorLoad(&ys[nodeIdx])), &ys[nodeIdx]);
+
+				displacementVec = VectorAdd(displacementVec, displacement);
+			}
+
+			float displacements[4];
+			VectorStore(displacementVec, displacements);
+
+			const bool bConverged = (displacements[0] + displacements[1] + displacements[2] + displacements[3]) < numNodes * 0.5f;
+
+			if (bConverged || FPlatformTime::Seconds() - lastProgressTime > progressInterval)
+			{
+				for (int32 nodeIdx = 0; nodeIdx < numNodes; nodeIdx++)
+				{
+					layoutGraph.Positions[nodeIdx] = FVector2D(xs[nodeIdx], ys[nodeIdx]);
+				}
+
+				if (bConverged)
+				{
+					return;
+				}
+
+				onProgress(layoutGraph);
+				lastProgressTime = FPlatformTime::Seconds();
+			}
+		}
+
+		for (int32 nodeIdx = 0; nodeIdx < numNodes; nodeIdx++)
+		{
+			layoutGraph.Positions[nodeIdx] = FVector2D(xs[nodeIdx], ys[nodeIdx]);
+		}
+	}
+
+	//--------------------------------------------------------------------
+	// Graph population and drawing
+	//--------------------------------------------------------------------
+
+	/** Node widgets further out of view than this fraction of the view size are released */
+	const float VIRTUALIZATION_MARGIN = 0.5f;
+	const float VIRTUALIZATION_INTERVAL = 0.5f;
+
+	/** Thumbnails are rendered smaller when zoomed out, memory is budgeted for all explorers together */
+	const uint32 THUMBNAIL_MAX_RESOLUTION = 128;
+	const uint32 THUMBNAIL_MIN_RESOLUTION = 64;
+	const SIZE_T THUMBNAIL_MEMORY_BUDGET = 64 * 1024 * 1024;
+
+	/** Gets memory of a thumbnail texture, RGBA8 */
+	SIZE_T GetThumbnailBytes(const uint32 resolution) { return SIZE_T(resolution) * resolution * 4; }
+
+	/** Graphs with more nodes are drawn from plain structs by a lite panel instead of graph nodes and their widgets */
+	const int32 LITE_GRAPH_THRESHOLD = 2048;
+
+	const FVector2D LITE_NODE_SIZE(240.f, 64.f);
+	const float LITE_WIRE_THICKNESS = 1.5f;
+	const float LITE_LABEL_MIN_ZOOM = 0.35f;
+	const float LITE_MIN_ZOOM = 0.005f;
+	const float LITE_MAX_ZOOM = 2.f;
+
+	/** Minimap raster size in pixels, it is redrawn at most this often while nodes move */
+	const FIntPoint MINIMAP_SIZE(240, 160);
+	const double MINIMAP_UPDATE_INTERVAL = 0.25;
+
+	/** Graphs with more nodes are populated over several frames */
+	const int32 POPULATE_PROGRESSIVE_THRESHOLD = 256;
+	const int32 POPULATE_BATCH_SIZE = 16;
+	const double POPULATE_FRAME_BUDGET = 0.008;
+
+	/** Time per frame spent loading referencers to collect their referencing properties */
+	const double PROPERTY_PINS_FRAME_BUDGET = 0.008;
+
+	/** Time per frame spent collecting in-memory references of edited packages, it runs while the user is editing */
+	const double UNSAVED_REFERENCES_FRAME_BUDGET = 0.002;
+
+	//--------------------------------------------------------------------
+	// Clusters
+	//--------------------------------------------------------------------
+
+	/** Roots with fewer referencers are never clustered */
+	const int32 CLUSTER_THRESHOLD = 64;
+
+	const FName CLUSTER_VALUE_NAME(TEXT("RefExplorerCluster"));
+
+	/** Gets the path up to and including the folder at the depth, e.g. /Game/Characters for depth 2 */
+	FString GetPathPrefix(const FString& path, const int32 depth)
+	{
+		int32 numSeparators = 0;
+
+		for (int32 charIdx = 0; charIdx < path.Len(); charIdx++)
+		{
+			if (path[charIdx] == '/' && ++numSeparators > depth)
+			{
+				return path.Left(charIdx);
+			}
+		}
+
+		return path;
+	}
+
+	/**
+	 * Gets the folder cluster the package belongs to, /Game is split by its top level folders and other mount points are a cluster each.
+	 * Expanded folders are split by their subfolders, and packages right in an expanded folder are not clustered
+	 */
+	FString GetClusterPath(const FString& packageName, const TSet<FString>& expandedClusters)
+	{
+		const FString packagePath = FPackageName::GetLongPackagePath(packageName);
+
+		int32 depth = packagePath.StartsWith(TEXT("/Game/")) ? 2 : 1;
+		FString clusterPath = GetPathPrefix(packagePath, depth);
+
+		while (expandedClusters.Contains(clusterPath))
+		{
+			if (clusterPath == packagePath)
+			{
+				return FString();
+			}
+
+			clusterPath = GetPathPrefix(packagePath, ++depth);
+		}
+
+		return clusterPath;
+	}
+
+	//--------------------------------------------------------------------
+	// Bundles
+	//--------------------------------------------------------------------
+
+	/** Fewer wires to the root from a folder are drawn as they are */
+	const int32 MIN_BUNDLE_SIZE = 3;
+
+	/** How far bundles join, from the members toward the root */
+	const double BUNDLE_JOIN_ALPHA = 0.5;
+
+	/** Bundle wires are tessellated once per layout change into this many straight segments */
+	const int32 BUNDLE_STRAND_SEGMENTS = 12;
+	const int32 BUNDLE_STRAND_POINTS = BUNDLE_STRAND_SEGMENTS + 1;
+
+	/** Adds points of a wire from start to end, with tangents matching the wires drawn by the connection drawing policy */
+	void AddBundleStrand(const FVector2D& start, const FVector2D& end, TArray<FVector2D>& outPoints)
+	{
+		const FVector2D tangent(FMath::Abs(start.X - end.X), 0.0);
+
+		for (int32 pointIndex = 0; pointIndex < BUNDLE_STRAND_POINTS; pointIndex++)
+		{
+			outPoints.Add(FMath::CubicInterp(start, tangent, end, tangent, double(pointIndex) / BUNDLE_STRAND_SEGMENTS));
+		}
+	}
+
+	//--------------------------------------------------------------------
+	// FAssetClassPresentation
+	//--------------------------------------------------------------------
+
+	/** Type color, icon and type name shared by nodes of one asset class */
+	struct FAssetClassPresentation
+	{
+		FLinearColor TypeColor;
+		FSlateIcon Icon;
+		FString TypeName;
+
+		/** Presentations of classes that are not loaded use the defaults, they are made again once the class is loaded */
+		bool bIsClassLoaded;
+	};
+
+	/** Gets the presentation of the asset's class, looked up once per class and again when a class that was not loaded is loaded. Valid until the next call */
+	const FAssetClassPresentation& GetAssetClassPresentation(const FAssetData& assetData)
+	{
+		static TMap<FTopLevelAssetPath, FAssetClassPresentation> presentations;
+
+		UClass* assetClass = nullptr;
+
+		if (const FAssetClassPresentation* presentation = presentations.Find(assetData.AssetClassPath))
+		{
+			if (presentation->bIsClassLoaded)
+			{
+				return *presentation;
+			}
+
+			assetClass = assetData.GetClass();
+
+			if (!assetClass)
+			{
+				return *presentation;
+			}
+		}
+		else
+		{
+			assetClass = assetData.GetClass();
+		}
+
+		FAssetClassPresentation& presentation = presentations.FindOrAdd(assetData.AssetClassPath);
+
+		presentation.bIsClassLoaded = assetClass != nullptr;
+
+		presentation.TypeColor = FLinearColor(0.55f, 0.55f, 0.55f);
+		presentation.TypeName = assetData.AssetClassPath.GetAssetName().ToString();
+		presentation.Icon = FSlateIcon("EditorStyle", FName(*("ClassIcon." + presentation.TypeName)));
+
+		if (assetClass)
+		{
+			FAssetToolsModule& assetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+
+			TWeakPtr<IAssetTypeActions> assetTypeActions = assetToolsModule.Get().GetAssetTypeActionsForClass(assetClass);
+			if (assetTypeActions.IsValid())
+			{
+				presentation.TypeColor = assetTypeActions.Pin()->GetTypeColor();
+			}
+		}
+
+		return presentation;
+	}
+
+	//--------------------------------------------------------------------
+	// Map packages
+	//--------------------------------------------------------------------
+
+	/** Packages without registry package data checked on disk for being maps, game thread only */
+	TMap<FName, bool> MapPackagesOnDisk;
+}
+//--------------------------------------------------------------------
+// FRefExplorerCommands
+//--------------------------------------------------------------------
+
+class FRefExplorerCommands : public TCommands<FRefExplorerCommands>
+{
+public:
+	FRefExplorerCommands() : TCommands<FRefExplorerCommands>(
+		"RefExplorerCommands", NSLOCTEXT("Contexts", "RefExplorerCommands", "Ref Explorer"),
+		NAME_None, FAppStyle::GetAppStyleSetName())
+	{}
+
+	// TCommands<> interface
+	virtual void RegisterCommands() override
+	{
+		UI_COMMAND(OpenSelectedInAssetEditor, "Edit...", "Opens the selected asset in the relevant editor.", EUserInterfaceActionType::Button, FInputChord(EModifierKey::Control, EKeys::E));
+		UI_COMMAND(ZoomToFit, "Zoom to Fit", "Zoom in and center the view on the selected item", EUserInterfaceActionType::Button, FInputChord(EKeys::F));
+
+		UI_COMMAND(CopyReferencedObjects, "Copy Referenced Objects List", "Copies the list of objects that the selected asset references to the clipboard.", EUserInterfaceActionType::Button, FInputChord());
+		UI_COMMAND(CopyReferencingObjects, "Copy Referencing Objects List", "Copies the list of objects that reference the selected asset to the clipboard.", EUserInterfaceActionType::Button, FInputChord());
+		UI_COMMAND(ShowReferencedObjects, "Show Referenced Objects List", "Shows a list of objects that the selected asset references.", EUserInterfaceActionType::Button, FInputChord());
+		UI_COMMAND(ShowReferencingObjects, "Show Referencing Objects List", "Shows a list of objects that reference the selected asset.", EUserInterfaceActionType::Button, FInputChord());
+		UI_COMMAND(ShowReferenceTree, "Show Reference Tree", "Shows a reference tree for the selected asset.", EUserInterfaceActionType::Button, FInputChord());
+
+		UI_COMMAND(ReadPropertiesFromDisk, "Read Properties From Disk", "Finds referencing properties by reading package files instead of loading referencers.", EUserInterfaceActionType::ToggleButton, FInputChord());
+		UI_COMMAND(ShowPropertyPins, "Show Property Pins", "Wires every referencing property to the root with its own pin.", EUserInterfaceActionType::ToggleButton, FInputChord());
+		UI_COMMAND(ShowUnsavedReferences, "Show Unsaved References", "Scans edited packages in memory and shows references that are not saved yet.", EUserInterfaceActionType::ToggleButton, FInputChord());
+
+		UI_COMMAND(RadialLayout, "Radial", "Places referencers on an arc around the root.", EUserInterfaceActionType::RadioButton, FInputChord());
+		UI_COMMAND(LayeredLayout, "Layered", "Places referencers in layers by distance from the root, ordered to reduce crossings.", EUserInterfaceActionType::RadioButton, FInputChord());
+		UI_COMMAND(ForceDirectedLayout, "Force Directed", "Lets linked nodes attract and all nodes repel each other until the graph settles.", EUserInterfaceActionType::RadioButton, FInputChord());
+		UI_COMMAND(KeepNodePositions, "Keep Node Positions", "Keeps nodes in place when the graph is refreshed and only places new nodes.", EUserInterfaceActionType::ToggleButton, FInputChord());
+		UI_COMMAND(ShowMinimap, "Show Minimap", "Shows an overview of all nodes. Click or drag in it to move the view.", EUserInterfaceActionType::ToggleButton, FInputChord());
+		UI_COMMAND(ClusterReferencers, "Cluster Referencers", "Groups referencers of assets with many referencers by content folder or plugin. Double-click a cluster to expand it.", EUserInterfaceActionType::ToggleButton, FInputChord());
+	}
+	// End of TCommands<> interface
+
+	// Opens the selected asset in the asset editor
+	TSharedPtr<FUICommandInfo> OpenSelectedInAssetEditor;
+
+	// Copies the list of objects that the selected asset references
+	TSharedPtr<FUICommandInfo> CopyReferencedObjects;
+
+	// Copies the list of objects that reference the selected asset
+	TSharedPtr<FUICommandInfo> CopyReferencingObjects;
+
+	// Shows a list of objects that the selected asset references
+	TSharedPtr<FUICommandInfo> ShowReferencedObjects;
+
+	// Shows a list of objects that reference the selected asset
+	TSharedPtr<FUICommandInfo> ShowReferencingObjects;
+
+	// Shows a reference tree for the selected asset
+	TSharedPtr<FUICommandInfo> ShowReferenceTree;
+
+	// Finds referencing properties without loading referencers
+	TSharedPtr<FUICommandInfo> ReadPropertiesFromDisk;
+
+	// Shows a pin per referencing property
+	TSharedPtr<FUICommandInfo> ShowPropertyPins;
+
+	// Overlays references of edited packages
+	TSharedPtr<FUICommandInfo> ShowUnsavedReferences;
+
+	// Layouts
+	TSharedPtr<FUICommandInfo> RadialLayout;
+	TSharedPtr<FUICommandInfo> LayeredLayout;
+	TSharedPtr<FUICommandInfo> ForceDirectedLayout;
+	TSharedPtr<FUICommandInfo> KeepNodePositions;
+
+	// Groups referencers by folder
+	TSharedPtr<FUICommandInfo> ClusterReferencers;
+
+	// Overview of all nodes
+	TSharedPtr<FUICommandInfo> ShowMinimap;
+
+	/** Zoom in to fit the selected objects in the window */
+	TSharedPtr<FUICommandInfo> ZoomToFit;
+};
+
+//--------------------------------------------------------------------
+// FRefExplorerConnectionDrawingPolicy
+//--------------------------------------------------------------------
+
+class FRefExplorerConnectionDrawingPolicy : public FConnectionDrawingPolicy
+{
+public:
+	FRefExplorerConnectionDrawingPolicy(int32 InBackLayerID, int32 InFrontLayerID, float InZoomFactor, const FSlateRect& InClippingRect, FSlateWindowElementList& InDrawElements, UEdGraph_RefExplorer* InGraph)
+		: FConnectionDrawingPolicy(InBackLayerID, InFrontLayerID, InZoomFactor, InClippingRect, InDrawElements)
+		, Graph(InGraph)
+		, GraphScale(0.f)
+	{}
+
+	virtual void Draw(TMap<TSharedRef<SWidget>, FArrangedWidget>& InPinGeometries, FArrangedChildren& ArrangedNodes) override
+	{
+		UpdateGraphToPanelTransform(ArrangedNodes);
+
+		FConnectionDrawingPolicy::Draw(InPinGeometries, ArrangedNodes);
+
+		DrawBundles();
+	}
+
+	using FConnectionDrawingPolicy::DrawSplineWithArrow;
+
+	virtual void DrawSplineWithArrow(const FVector2D& StartPoint, const FVector2D& EndPoint, const FConnectionParams& Params) override
+	{
+		int32 MemberIndex = INDEX_NONE;
+
+		// Wires to the root are gathered and drawn as bundles once all of them are known
+		if (const FRefExplorerNodeAggregate* NodeAggregate = GetBundleAggregate(Params, MemberIndex))
+		{
+			FBundledWire& BundledWire = BundledWires.FindOrAdd(NodeAggregate).Emplace_GetRef();
+			BundledWire.Start = StartPoint;
+			BundledWire.End = EndPoint;
+			BundledWire.Params = Params;
+			BundledWire.MemberIndex = MemberIndex;
+			return;
+		}
+
+		FConnectionDrawingPolicy::DrawSplineWithArrow(StartPoint, EndPoint, Params);
+	}
+
+	virtual FVector2D ComputeSplineTangent(const FVector2D& Start, const FVector2D& End) const override
+	{
+		const int32 Tension = FMath::Abs<int32>(Start.X - End.X);
+		return Tension * FVector2D(1.0f, 0);
+	}
+
+	virtual void DrawConnection(int32 LayerId, const FVector2D& Start, const FVector2D& End, const FConnectionParams& Params) override
+	{
+		// Splines stay within the hull of their Bezier control points, wires out of view are skipped before being built
+		const FVector2D Tangent = ComputeSplineTangent(Start, End) / 3.0;
+
+		const FSlateRect WireBounds = FSlateRect(Start.ComponentMin(End), Start.ComponentMax(End)).ExtendBy(FMargin(FMath::Max(float(Tangent.Size()), Params.WireThickness)));
+
+		if (!FSlateRect::DoRectanglesIntersect(WireBounds, ClippingRect))
+		{
+			return;
+		}
+
+		FConnectionDrawingPolicy::DrawConnection(LayerId, Start, End, Params);
+	}
+
+	virtual void DetermineWiringStyle(UEdGraphPin* OutputPin, UEdGraphPin* InputPin, /*inout*/ FConnectionParams& Params) override
+	{
+		const UEdGraphNode_RefExplorer* OutputNode = Cast<UEdGraphNode_RefExplorer>(OutputPin->GetOwningNode());
+		const UEdGraphNode_RefExplorer* InputNode = Cast<UEdGraphNode_RefExplorer>(InputPin->GetOwningNode());
+
+		if (!OutputNode || !InputNode)
+		{
+			return;
+		}
+
+		// Categories are stored when pins are set up, parsing pin category names for every wire every frame is too slow on big graphs
+		FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory OutputCategory = OutputNode->GetPinCategory(OutputPin);
+		FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory InputCategory = InputNode->GetPinCategory(InputPin);
+
+		FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory Category = !!(OutputCategory & FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkEndActive) ? OutputCategory : InputCategory;
+		Params.WireColor = GetColor(Category);
+
+		// Unsaved links are animated so they stand out from the saved ones
+		Params.bDrawBubbles = !!(Category & FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkStateUnsaved);
+		Params.WireThickness = OutputNode->GetWireThickness(OutputPin, Params.WireThickness);
+	}
+
+private:
+	struct FBundledWire
+	{
+		FVector2D Start;
+		FVector2D End;
+		FConnectionParams Params;
+		int32 MemberIndex;
+	};
+
+	/** Gets the aggregate the wire is bundled with and the index of its referencer in it, nullptr if it is drawn on its own */
+	const FRefExplorerNodeAggregate* GetBundleAggregate(const FConnectionParams& Params, int32& OutMemberIndex) const
+	{
+		// Animated wires are drawn on their own, bundles are drawn as plain geometry
+		if (!Graph || GraphScale <= 0.f || !Params.AssociatedPin1 || !Params.AssociatedPin2 || Params.bDrawBubbles)
+		{
+			return nullptr;
+		}
+
+		UEdGraphNode_RefExplorer* OutputNode = Cast<UEdGraphNode_RefExplorer>(Params.AssociatedPin1->GetOwningNode());
+		const UEdGraphNode_RefExplorer* InputNode = Cast<UEdGraphNode_RefExplorer>(Params.AssociatedPin2->GetOwningNode());
+
+		if (!OutputNode || !InputNode || InputNode->GetIdentifier() != Graph->GetGraphRootIdentifier())
+		{
+			return nullptr;
+		}
+
+		OutMemberIndex = OutputNode->GetAggregateMemberIndex();
+
+		return Graph->GetNodeAggregate(OutputNode);
+	}
+
+	/** Nodes are arranged with a uniform scale, so any arranged node maps graph space to panel space */
+	void UpdateGraphToPanelTransform(const FArrangedChildren& ArrangedNodes)
+	{
+		GraphScale = 0.f;
+
+		for (int32 NodeIdx = 0; NodeIdx < ArrangedNodes.Num(); NodeIdx++)
+		{
+			const FArrangedWidget& ArrangedNode = ArrangedNodes[NodeIdx];
+
+			if (const UEdGraphNode* Node = StaticCastSharedRef<SGraphNode>(ArrangedNode.Widget)->GetNodeObj())
+			{
+				GraphOrigin = FVector2D(Node->NodePosX, Node->NodePosY);
+				PanelOrigin = FVector2D(ArrangedNode.Geometry.GetAbsolutePosition());
+				GraphScale = ArrangedNode.Geometry.Scale;
+				return;
+			}
+		}
+	}
+
+	FVector2D GraphToPanel(const FVector2D& GraphLocation) const
+	{
+		return PanelOrigin + (GraphLocation - GraphOrigin) * GraphScale;
+	}
+
+	/** Adds a wire tessellated by the graph to the batch, the end at the pin is moved to where the pin is drawn */
+	void AddBundleStrand(const TArray<FVector2D>& BundlePoints, int32 StrandIndex, const FVector2D& PinLocation, bool bPinAtEnd, float Thickness, const FLinearColor& Color, const FSlateResourceHandle& ResourceHandle, TArray<FSlateVertex>& Vertices, TArray<SlateIndex>& Indices) const
+	{
+		using namespace FRefExplorerEditorModule_PRIVATE;
+
+		const int32 FirstPoint = StrandIndex * BUNDLE_STRAND_POINTS;
+
+		if (StrandIndex < 0 || FirstPoint + BUNDLE_STRAND_POINTS > BundlePoints.Num())
+		{
+			return;
+		}
+
+		FVector2D Points[BUNDLE_STRAND_POINTS];
+
+		for (int32 PointIndex = 0; PointIndex < BUNDLE_STRAND_POINTS; PointIndex++)
+		{
+			Points[PointIndex] = GraphToPanel(BundlePoints[FirstPoint + PointIndex]);
+		}
+
+		Points[bPinAtEnd ? BUNDLE_STRAND_SEGMENTS : 0] = PinLocation;
+
+		FVector2D BoundsMin = Points[0];
+		FVector2D BoundsMax = Points[0];
+
+		for (const FVector2D& Point : Points)
+		{
+			BoundsMin = BoundsMin.ComponentMin(Point);
+			BoundsMax = BoundsMax.ComponentMax(Point);
+		}
+
+		if (!FSlateRect::DoRectanglesIntersect(FSlateRect(BoundsMin, BoundsMax).ExtendBy(FMargin(Thickness)), ClippingRect))
+		{
+			return;
+		}
+
+		const FColor QuadColor = Color.ToFColor(true);
+
+		for (int32 SegmentIndex = 0; SegmentIndex < BUNDLE_STRAND_SEGMENTS; SegmentIndex++)
+		{
+			const FVector2D Normal = (Points[SegmentIndex + 1] - Points[SegmentIndex]).GetSafeNormal().GetRotated(90.f) * Thickness * 0.5f;
+
+			const FVector2D Corners[4] = { Points[SegmentIndex] + Normal, Points[SegmentIndex] - Normal, Points[SegmentIndex + 1] - Normal, Points[SegmentIndex + 1] + Normal };
+			AddQuad(DrawElementsList, WireLayerID, ResourceHandle, FSlateRenderTransform(), Corners, QuadColor, Vertices, Indices);
+		}
+	}
+
+	/** Draws all bundles of the frame as a single batch of vertices, from points the graph keeps while nodes do not move */
+	void DrawBundles()
+	{
+		const FSlateResourceHandle ResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*FCoreStyle::Get().GetBrush("WhiteBrush"));
+
+		TArray<FSlateVertex> Vertices;
+		TArray<SlateIndex> Indices;
+
+		for (const TPair<const FRefExplorerNodeAggregate*, TArray<FBundledWire>>& Bundle : BundledWires)
+		{
+			const FRefExplorerNodeAggregate* NodeAggregate = Bundle.Key;
+			const TArray<FBundledWire>& Wires = Bundle.Value;
+
+			if (Wires.Num() < FRefExplorerEditorModule_PRIVATE::MIN_BUNDLE_SIZE)
+			{
+				for (const FBundledWire& Wire : Wires)
+				{
+					FConnectionDrawingPolicy::DrawSplineWithArrow(Wire.Start, Wire.End, Wire.Params);
+				}
+
+				continue;
+			}
+
+			// Strands keep the color of their category, the shared trunk takes the one most of them have
+			TArray<TPair<FLinearColor, int32>, TInlineAllocator<4>> ColorCounts;
+
+			for (const FBundledWire& Wire : Wires)
+			{
+				AddBundleStrand(NodeAggregate->BundlePoints, Wire.MemberIndex, Wire.Start, false, Wire.Params.WireThickness, Wire.Params.WireColor, ResourceHandle, Vertices, Indices);
+
+				if (TPair<FLinearColor, int32>* ColorCount = ColorCounts.FindByPredicate([&](const TPair<FLinearColor, int32>& Pair) { return Pair.Key == Wire.Params.WireColor; }))
+				{
+					ColorCount->Value++;
+				}
+				else
+				{
+					ColorCounts.Emplace(Wire.Params.WireColor, 1);
+				}
+			}
+
+			const FLinearColor TrunkColor = Algo::MaxElementBy(ColorCounts, [](const TPair<FLinearColor, int32>& Pair) { return Pair.Value; })->Key;
+
+			// The shared part is drawn once, thicker the more wires it carries
+			AddBundleStrand(NodeAggregate->BundlePoints, NodeAggregate->Members.Num(), Wires[0].End, true, Wires[0].Params.WireThickness * FMath::Min(FMath::Sqrt(float(Wires.Num())), 4.f), TrunkColor, ResourceHandle, Vertices, Indices);
+
+			if (ArrowImage)
+			{
+				FSlateDrawElement::MakeBox(DrawElementsList, ArrowLayerID, FPaintGeometry(Wires[0].End - ArrowRadius, ArrowImage->ImageSize * ZoomFactor, ZoomFactor), ArrowImage, ESlateDrawEffect::None, TrunkColor);
+			}
+		}
+
+		if (!Vertices.IsEmpty())
+		{
+			FSlateDrawElement::MakeCustomVerts(DrawElementsList, WireLayerID, ResourceHandle, Vertices, Indices, nullptr, 0, 0);
+		}
+
+		BundledWires.Reset();
+	}
+
+	UEdGraph_RefExplorer* Graph;
+
+	FVector2D GraphOrigin;
+	FVector2D PanelOrigin;
+	float GraphScale;
+
+	/** Wires to the root by aggregate, filled while drawing a frame */
+	TMap<const FRefExplorerNodeAggregate*, TArray<FBundledWire>> BundledWires;
+};
+
+//--------------------------------------------------------------------
+// URefExplorerSchema
+//--------------------------------------------------------------------
+
+URefExplorerSchema::URefExplorerSchema(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+void URefExplorerSchema::GetContextMenuActions(UToolMenu* Menu, UGraphNodeContextMenuContext* Context) const
+{
+	{
+		FToolMenuSection& Section = Menu->AddSection(TEXT("Asset"), NSLOCTEXT("RefExplorerSchema", "AssetSectionLabel", "Asset"));
+		Section.AddMenuEntry(FGlobalEditorCommonCommands::Get().FindInContentBrowser);
+		Section.AddMenuEntry(FRefExplorerCommands::Get().OpenSelectedInAssetEditor);
+	}
+
+	{
+		FToolMenuSection& Section = Menu->AddSection(TEXT("Misc"), NSLOCTEXT("RefExplorerSchema", "MiscSectionLabel", "Misc"));
+		Section.AddMenuEntry(FRefExplorerCommands::Get().ZoomToFit);
+	}
+
+	{
+		FToolMenuSection& Section = Menu->AddSection(TEXT("References"), NSLOCTEXT("RefExplorerSchema", "ReferencesSectionLabel", "References"));
+		Section.AddMenuEntry(FRefExplorerCommands::Get().CopyReferencedObjects);
+		Section.AddMenuEntry(FRefExplorerCommands::Get().CopyReferencingObjects);
+		Section.AddMenuEntry(FRefExplorerCommands::Get().ShowReferencedObjects);
+		Section.AddMenuEntry(FRefExplorerCommands::Get().ShowReferencingObjects);
+		Section.AddMenuEntry(FRefExplorerCommands::Get().ShowReferenceTree);
+	}
+}
+
+FLinearColor URefExplorerSchema::GetPinTypeColor(const FEdGraphPinType& PinType) const
+{
+	return FRefExplorerEditorModule_PRIVATE::GetColor(FRefExplorerEditorModule_PRIVATE::ParseDependencyPinCategory(PinType.PinCategory));
+}
+
+FConnectionDrawingPolicy* URefExplorerSchema::CreateConnectionDrawingPolicy(int32 InBackLayerID, int32 InFrontLayerID, float InZoomFactor, const FSlateRect& InClippingRect, class FSlateWindowElementList& InDrawElements, class UEdGraph* InGraphObj) const
+{
+	return new FRefExplorerConnectionDrawingPolicy(InBackLayerID, InFrontLayerID, InZoomFactor, InClippingRect, InDrawElements, Cast<UEdGraph_RefExplorer>(InGraphObj));
+}
+
+//--------------------------------------------------------------------
+// UEdGraphNode_RefExplorer
+//--------------------------------------------------------------------
+
+UEdGraphNode_RefExplorer::UEdGraphNode_RefExplorer(const FObjectInitializer& ObjectInitializer) :Super(ObjectInitializer)
+{
+	bUsesThumbnail = false;
+	bIsPackage = false;
+	bIsPrimaryAsset = false;
+	NumClusterMembers = 0;
+	AggregateIndex = INDEX_NONE;
+	AggregateMemberIndex = INDEX_NONE;
+	DependencyPinCategory = FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkEndPassive;
+	FullDetailSize = FVector2D::ZeroVector;
+
+	AssetTypeColor = FLinearColor(0.55f, 0.55f, 0.55f);
+
+	DependencyPin = NULL;
+	ReferencerPin = NULL;
+}
+
+void UEdGraphNode_RefExplorer::SetupRefExplorerNode(const FIntPoint& NodeLoc, const FAssetIdentifier& NewIdentifier, const FAssetData& InAssetData)
+{
+	NodePosX = NodeLoc.X;
+	NodePosY = NodeLoc.Y;
+
+	// Widgets are looked up by guid
+	CreateNewGuid();
+
+	Identifier = NewIdentifier;
+
+	const FRefExplorerEditorModule_PRIVATE::FAssetClassPresentation& ClassPresentation = FRefExplorerEditorModule_PRIVATE::GetAssetClassPresentation(InAssetData);
+
+	FString MainAssetName = InAssetData.AssetName.ToString();
+	FString AssetTypeName = ClassPresentation.TypeName;
+
+	AssetTypeColor = ClassPresentation.TypeColor;
+	AssetBrush = ClassPresentation.Icon;
+
+	bIsPackage = true;
+
+	FPrimaryAssetId PrimaryAssetID = Identifier.GetPrimaryAssetId();
+	if (PrimaryAssetID.IsValid())  // Management References (PrimaryAssetIDs)
+	{
+		static FText ManagerText = LOCTEXT("ReferenceManager", "Manager");
+		MainAssetName = PrimaryAssetID.PrimaryAssetType.ToString() + TEXT(":") + PrimaryAssetID.PrimaryAssetName.ToString();
+		AssetTypeName = ManagerText.ToString();
+		
+		bIsPackage = false;
+		bIsPrimaryAsset = true;
+	}
+	else if (Identifier.IsValue()) // Searchable Names (GamePlay Tags, Data Table Row Handle)
+	{
+		MainAssetName = Identifier.ValueName.ToString();
+		AssetTypeName = Identifier.ObjectName.ToString();
+		static const FName NAME_DataTable(TEXT("DataTable"));
+		static const FText InDataTableText = LOCTEXT("InDataTable", "In DataTable");
+		if (InAssetData.AssetClassPath.GetAssetName() == NAME_DataTable)
+		{
+			AssetTypeName = InDataTableText.ToString() + TEXT(" ") + AssetTypeName;
+		}
+
+		bIsPackage = false;
+	}
+	else if (Identifier.IsPackage() && !InAssetData.IsValid())
+	{
+		const FString PackageNameStr = Identifier.PackageName.ToString();
+		if (PackageNameStr.StartsWith(TEXT("/Script")))// C++ Packages (/Script Code)
+		{
+			MainAssetName = PackageNameStr.RightChop(8);
+			AssetTypeName = TEXT("Script");
+		}
+	}
+
+	static const FName NAME_ActorLabel(TEXT("ActorLabel"));
+	InAssetData.GetTagValue(NAME_ActorLabel, MainAssetName);
+
+	// append the type so it shows up on the extra line
+	MainAssetName.Reserve(MainAssetName.Len() + 1 + AssetTypeName.Len());
+	MainAssetName.AppendChar(TEXT('\n'));
+	MainAssetName.Append(AssetTypeName);
+
+	NodeTitle = FText::FromString(MoveTemp(MainAssetName));
+
+	if (bIsPackage)
+	{
+		NodeComment = Identifier.PackageName.ToString();
+	}
+
+	if (InAssetData.IsValid() && IsPackage())
+	{
+		bUsesThumbnail = true;
+		CachedAssetData = InAssetData;
+	}
+	else
+	{
+		bUsesThumbnail = false;
+		CachedAssetData = FAssetData();
+
+		const FString PackageNameStr = Identifier.PackageName.ToString();
+		if (FPackageName::IsValidLongPackageName(PackageNameStr, true))
+		{
+			if (PackageNameStr.StartsWith(TEXT("/Script")))
+			{
+				// Used Only in the UI for the Thumbnail
+				CachedAssetData.AssetClassPath = FTopLevelAssetPath(TEXT("/EdGraphNode_Reference"), TEXT("Code"));
+			}
+			else
+			{
+				// Packages unknown to the registry are checked on disk once all nodes are created
+				bool bIsMapPackage = false;
+				if (GetRefExplorerGraph()->FindIsMapPackage(Identifier.PackageName, bIsMapPackage) && bIsMapPackage)
+				{
+					SetMapPackage();
+				}
+			}
+		}
+	}
+
+	AllocateDefaultPins();
+}
+
+void UEdGraphNode_RefExplorer::SetMapPackage()
+{
+	// Used Only in the UI for the Thumbnail
+	CachedAssetData.AssetClassPath = TEXT("/Script/Engine.World");
+}
+
+void UEdGraphNode_RefExplorer::SetupClusterNode(const FIntPoint& NodeLoc, const FAssetIdentifier& NewIdentifier, int32 InNumClusterMembers)
+{
+	NodePosX = NodeLoc.X;
+	NodePosY = NodeLoc.Y;
+
+	// Widgets are looked up by guid
+	CreateNewGuid();
+
+	Identifier = NewIdentifier;
+	NumClusterMembers = InNumClusterMembers;
+
+	AssetTypeColor = FLinearColor(0.8f, 0.6f, 0.2f);
+	AssetBrush = FSlateIcon(FAppStyle::GetAppStyleSetName(), "ContentBrowser.AssetTreeFolderClosed");
+
+	NodeTitle = FText::Format(LOCTEXT("ClusterNodeTitle", "{0}\n{1} referencers"), FText::FromString(GetClusterPath()), FText::AsNumber(NumClusterMembers));
+
+	bIsPackage = false;
+	bUsesThumbnail = false;
+	CachedAssetData = FAssetData();
+
+	AllocateDefaultPins();
+}
+
+void UEdGraphNode_RefExplorer::AddReferencer(UEdGraphNode_RefExplorer* ReferencerNode)
+{
+	AddReferencer(ReferencerNode->GetDependencyPin());
+}
+
+void UEdGraphNode_RefExplorer::AddReferencer(UEdGraphPin* ReferencerDependencyPin)
+{
+	if (ensure(ReferencerDependencyPin))
+	{
+		ReferencerDependencyPin->bHidden = false;
+		ReferencerPin->bHidden = false;
+		ReferencerPin->MakeLinkTo(ReferencerDependencyPin);
+	}
+}
+
+void UEdGraphNode_RefExplorer::SetupPropertyPins(const TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo>& RefPropInfos, UEdGraphNode_RefExplorer* RootNode)
+{
+	using namespace FRefExplorerEditorModule_PRIVATE;
+
+	const bool bHadPropertyPins = HasPropertyPins();
+
+	RemovePropertyPins();
+
+	if (RefPropInfos.IsEmpty())
+	{
+		// Fall back to the single link to the root
+		if (bHadPropertyPins)
+		{
+			RootNode->AddReferencer(this);
+		}
+
+		return;
+	}
+
+	struct FPropertyPinInfo
+	{
+		int32 ReferenceCount = 0;
+		bool bIsHard = false;
+		FString ToolTip;
+	};
+
+	TMap<FString, FPropertyPinInfo> PropertyPinInfos;
+
+	for (const FRefPropInfo& RefPropInfo : RefPropInfos)
+	{
+		FPropertyPinInfo& PropertyPinInfo = PropertyPinInfos.FindOrAdd(RefPropInfo.GetTopLevelName());
+		PropertyPinInfo.ReferenceCount++;
+		PropertyPinInfo.bIsHard |= !RefPropInfo.IsSoft;
+		PropertyPinInfo.ToolTip += (PropertyPinInfo.ToolTip.IsEmpty() ? TEXT("") : TEXT("\n")) + RefPropInfo.Name;
+	}
+
+	PropertyPinInfos.KeySort(TLess<FString>());
+
+	const EDependencyPinCategory LinkCategory = DependencyPinCategory;
+
+	DependencyPin->BreakAllPinLinks();
+	DependencyPin->bHidden = true;
+
+	for (const TPair<FString, FPropertyPinInfo>& PropertyPinInfo : PropertyPinInfos)
+	{
+		EDependencyPinCategory Category = EDependencyPinCategory::LinkEndActive | (LinkCategory & (EDependencyPinCategory::LinkTypeUsedInGame | EDependencyPinCategory::LinkStateMask));
+		Category |= PropertyPinInfo.Value.bIsHard ? EDependencyPinCategory::LinkTypeHard : EDependencyPinCategory::LinkTypeNone;
+
+		UEdGraphPin* PropertyPin = CreatePin(EEdGraphPinDirection::EGPD_Output, GetName(Category), FName(*PropertyPinInfo.Key));
+		PropertyPin->PinFriendlyName = FText::FromString(PropertyPinInfo.Key);
+		PropertyPin->PinToolTip = PropertyPinInfo.Value.ToolTip;
+
+		PropertyPins.Add(PropertyPin);
+		PropertyPinReferenceCounts.Add(PropertyPin, PropertyPinInfo.Value.ReferenceCount);
+		PropertyPinCategories.Add(PropertyPin, Category);
+
+		RootNode->AddReferencer(PropertyPin);
+	}
+}
+
+void UEdGraphNode_RefExplorer::RemovePropertyPins()
+{
+	for (UEdGraphPin* PropertyPin : PropertyPins)
+	{
+		RemovePin(PropertyPin);
+	}
+
+	PropertyPins.Reset();
+	PropertyPinReferenceCounts.Reset();
+	PropertyPinCategories.Reset();
+}
+
+void UEdGraphNode_RefExplorer::SetDependencyPinCategory(FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory Category)
+{
+	DependencyPinCategory = Category;
+	DependencyPin->PinType.PinCategory = FRefExplorerEditorModule_PRIVATE::GetName(Category);
+}
+
+FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory UEdGraphNode_RefExplorer::GetPinCategory(const UEdGraphPin* Pin) const
+{
+	if (Pin == DependencyPin)
+	{
+		return DependencyPinCategory;
+	}
+	else if (Pin == ReferencerPin || PropertyPinCategories.IsEmpty())
+	{
+		return FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkEndPassive;
+	}
+
+	return PropertyPinCategories.FindRef(Pin);
+}
+
+float UEdGraphNode_RefExplorer::GetWireThickness(const UEdGraphPin* Pin, float DefaultThickness) const
+{
+	const int32 ReferenceCount = PropertyPinReferenceCounts.IsEmpty() ? 0 : PropertyPinReferenceCounts.FindRef(Pin);
+	return ReferenceCount > 0 ? FMath::Min(DefaultThickness + FMath::Log2((float)ReferenceCount) * 1.5f, 8.0f) : DefaultThickness;
+}
+
+UEdGraph_RefExplorer* UEdGraphNode_RefExplorer::GetRefExplorerGraph() const { return Cast<UEdGraph_RefExplorer>(GetGraph()); }
+
+FLinearColor UEdGraphNode_RefExplorer::GetNodeTitleColor() const
+{
+	if (bIsPrimaryAsset)
+	{
+		return FLinearColor(0.2f, 0.8f, 0.2f);
+	}
+	else if (bIsPackage || IsCluster())
+	{
+		return AssetTypeColor;
+	}
+	else
+	{
+		return FLinearColor(0.0f, 0.55f, 0.62f);
+	}
+}
+
+FText UEdGraphNode_RefExplorer::GetTooltipText() const
+{
+	if (IsCluster())
+	{
+		return FText::Format(LOCTEXT("ClusterNodeTooltip", "{0} referencers in {1}\nDouble-click to expand"), FText::AsNumber(NumClusterMembers), FText::FromString(GetClusterPath()));
+	}
+
+	return FText::FromString(Identifier.ToString());
+}
+
+void UEdGraphNode_RefExplorer::AllocateDefaultPins()
+{
+	FName PassiveName = FRefExplorerEditorModule_PRIVATE::GetName(FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkEndPassive);
+
+	ReferencerPin = CreatePin(EEdGraphPinDirection::EGPD_Input, NAME_None, NAME_None);
+	ReferencerPin->bHidden = true;
+	ReferencerPin->PinType.PinCategory = PassiveName;
+
+	DependencyPin = CreatePin(EEdGraphPinDirection::EGPD_Output, NAME_None, NAME_None);
+	DependencyPin->bHidden = true;
+	DependencyPin->PinType.PinCategory = PassiveName;
+}
+
+//--------------------------------------------------------------------
+// FRefExplorerSpatialIndex
+//--------------------------------------------------------------------
+
+void FRefExplorerSpatialIndex::Reset()
+{
+	Items.Reset();
+	Cells.Reset();
+}
+
+FIntPoint FRefExplorerSpatialIndex::GetCell(const FVector2D& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+int32 FRefExplorerSpatialIndex::Add(const FBox2D& Bounds)
+{
+	const int32 Index = Items.Add(Bounds);
+
+	const FIntPoint MinCell = GetCell(Bounds.Min);
+	const FIntPoint MaxCell = GetCell(Bounds.Max);
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+		{
+			Cells.FindOrAdd(FIntPoint(CellX, CellY)).Add(Index);
+		}
+	}
+
+	return Index;
+}
+
+void FRefExplorerSpatialIndex::Query(const FBox2D& Bounds, TArray<int32>& OutIndices) const
+{
+	OutIndices.Reset();
+
+	// Rectangles are in every cell they touch, each one is only added once
+	TBitArray<> FoundItems(false, Items.Num());
+
+	const FIntPoint MinCell = GetCell(Bounds.Min);
+	const FIntPoint MaxCell = GetCell(Bounds.Max);
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+		{
+			if (const TArray<int32>* CellIndices = Cells.Find(FIntPoint(CellX, CellY)))
+			{
+				for (const int32 Index : *CellIndices)
+				{
+					const FBox2D& ItemBounds = Items[Index];
+
+					// Touching edges do not count as overlap
+					if (!FoundItems[Index] && ItemBounds.Min.X < Bounds.Max.X && Bounds.Min.X < ItemBounds.Max.X && ItemBounds.Min.Y < Bounds.Max.Y && Bounds.Min.Y < ItemBounds.Max.Y)
+					{
+						FoundItems[Index] = true;
+						OutIndices.Add(Index);
+					}
+				}
+			}
+		}
+	}
+}
+
+bool FRefExplorerSpatialIndex::Overlaps(const FBox2D& Bounds) const
+{
+	const FIntPoint MinCell = GetCell(Bounds.Min);
+	const FIntPoint MaxCell = GetCell(Bounds.Max);
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+		{
+			if (const TArray<int32>* CellIndices = Cells.Find(FIntPoint(CellX, CellY)))
+			{
+				for (const int32 Index : *CellIndices)
+				{
+					const FBox2D& ItemBounds = Items[Index];
+
+					if (ItemBounds.Min.X < Bounds.Max.X && Bounds.Min.X < ItemBounds.Max.X && ItemBounds.Min.Y < Bounds.Max.Y && Bounds.Min.Y < ItemBounds.Max.Y)
+					{
+						return true;
+					}
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+FVector2D FRefExplorerSpatialIndex::FindFreeLocation(const FVector2D& DesiredLocation, const FVector2D& Size, const FVector2D& Step) const
+{
+	// Candidates are tried ring by ring, a ring of radius R has 8R of them
+	const int32 MaxCandidates = 8192;
+
+	const FVector2D RingStepSize = Step.IsNearlyZero() ? Size : Step;
+
+	TArray<FIntPoint> RingSteps;
+
+	for (int32 Ring = 0, NumCandidates = 0; NumCandidates < MaxCandidates; NumCandidates += RingSteps.Num(), Ring++)
+	{
+		// Steps on the ring, closest to the desired location first
+		RingSteps.Reset();
+
+		if (Ring == 0)
+		{
+			RingSteps.Add(FIntPoint::ZeroValue);
+		}
+
+		for (int32 Offset = -Ring; Offset < Ring; Offset++)
+		{
+			RingSteps.Add(FIntPoint(Offset, -Ring));
+			RingSteps.Add(FIntPoint(Ring, Offset));
+			RingSteps.Add(FIntPoint(-Offset, Ring));
+			RingSteps.Add(FIntPoint(-Ring, -Offset));
+		}
+
+		RingSteps.Sort([&RingStepSize](const FIntPoint& A, const FIntPoint& B) { return FVector2D(A.X * RingStepSize.X, A.Y * RingStepSize.Y).SizeSquared() < FVector2D(B.X * RingStepSize.X, B.Y * RingStepSize.Y).SizeSquared(); });
+
+		for (const FIntPoint& RingStep : RingSteps)
+		{
+			const FVector2D Location = DesiredLocation + FVector2D(RingStep.X * RingStepSize.X, RingStep.Y * RingStepSize.Y);
+
+			if (!Overlaps(FBox2D(Location, Location + Size)))
+			{
+				return Location;
+			}
+		}
+	}
+
+	return DesiredLocation;
+}
+
+//--------------------------------------------------------------------
+// FRefExplorerUnsavedReferenceScanner
+//--------------------------------------------------------------------
+
+FRefExplorerUnsavedReferenceScanner::FRefExplorerUnsavedReferenceScanner()
+{
+	ScanningObjectIdx = 0;
+	PendingPackageHead = 0;
+	bRescanScanningPackage = false;
+
+	PackageMarkedDirtyHandle = UPackage::PackageMarkedDirtyEvent.AddRaw(this, &FRefExplorerUnsavedReferenceScanner::OnPackageMarkedDirty);
+	PackageDirtyStateChangedHandle = UPackage::PackageDirtyStateChangedEvent.AddRaw(this, &FRefExplorerUnsavedReferenceScanner::OnPackageDirtyStateChanged);
+
+	// Packages edited before the explorer was opened
+	TArray<UPackage*> DirtyPackages;
+	FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+
+	for (UPackage* DirtyPackage : DirtyPackages)
+	{
+		EnqueuePackage(DirtyPackage);
+	}
+}
+
+FRefExplorerUnsavedReferenceScanner::~FRefExplorerUnsavedReferenceScanner()
+{
+	UPackage::PackageMarkedDirtyEvent.Remove(PackageMarkedDirtyHandle);
+	UPackage::PackageDirtyStateChangedEvent.Remove(PackageDirtyStateChangedHandle);
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+}
+
+void FRefExplorerUnsavedReferenceScanner::OnPackageMarkedDirty(UPackage* Package, bool bWasDirty)
+{
+	EnqueuePackage(Package);
+}
+
+void FRefExplorerUnsavedReferenceScanner::OnPackageDirtyStateChanged(UPackage* Package)
+{
+	if (!Package || Package->IsDirty())
+	{
+		return;
+	}
+
+	// Saved or reverted, saved references are valid again. Queue entries without a pending name are skipped
+	PendingPackageNames.Remove(Package->GetFName());
+
+	if (ScanningPackage == Package)
+	{
+		ScanningPackage.Reset();
+		ScanningObjects.Reset();
+		bRescanScanningPackage = false;
+	}
+
+	TSet<FName> RemovedReferences;
+
+	if (UnsavedReferences.RemoveAndCopyValue(Package->GetFName(), RemovedReferences))
+	{
+		OnUnsavedReferencesChanged.ExecuteIfBound(Package->GetFName(), RemovedReferences);
+	}
+	OnScanningChanged.ExecuteIfBound();
+}
+
+void FRefExplorerUnsavedReferenceScanner::EnqueuePackage(UPackage* Package)
+{
+	if (!Package || Package == GetTransientPackage() || Package->HasAnyPackageFlags(PKG_CompiledIn | PKG_PlayInEditor))
+	{
+		return;
+	}
+
+	// Edited again while being scanned, it is scanned once more when done instead of starting over, which would never end for a package being edited
+	if (ScanningPackage == Package)
+	{
+		bRescanScanningPackage = true;
+		return;
+	}
+
+	bool bIsAlreadyPending = false;
+	PendingPackageNames.Add(Package->GetFName(), &bIsAlreadyPending);
+
+	if (bIsAlreadyPending)
+	{
+		return;
+	}
+
+	PendingPackages.Add(Package);
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FRefExplorerUnsavedReferenceScanner::Tick));
+	}
+
+	OnScanningChanged.ExecuteIfBound();
+}
+
+bool FRefExplorerUnsavedReferenceScanner::StartNextPackage()
+{
+	while (PendingPackageHead < PendingPackages.Num())
+	{
+		UPackage* Package = PendingPackages[PendingPackageHead++].Get();
+
+		if (Package && PendingPackageNames.Remove(Package->GetFName()) > 0 && Package->IsDirty())
+		{
+			TArray<UObject*> Objects;
+			GetObjectsWithPackage(Package, Objects, true, RF_Transient);
+
+			ScanningPackage = Package;
+			ScanningObjects.Reset(Objects.Num());
+			ScanningObjects.Append(Objects);
+			ScanningObjectIdx = 0;
+			ScanningReferences.Reset();
+
+			return true;
+		}
+	}
+
+	PendingPackages.Reset();
+	PendingPackageHead = 0;
+	PendingPackageNames.Reset();
+
+	return false;
+}
+
+void FRefExplorerUnsavedReferenceScanner::FinishPackage()
+{
+	UPackage* Package = ScanningPackage.Get();
+	ScanningPackage.Reset();
+	ScanningObjects.Reset();
+
+	if (!Package || !Package->IsDirty())
+	{
+		bRescanScanningPackage = false;
+		return;
+	}
+
+	if (bRescanScanningPackage)
+	{
+		bRescanScanningPackage = false;
+		EnqueuePackage(Package);
+	}
+
+	TSet<FName>& References = UnsavedReferences.FindOrAdd(Package->GetFName());
+
+	TSet<FName> ChangedReferences = References.Difference(ScanningReferences).Union(ScanningReferences.Difference(References));
+	References = MoveTemp(ScanningReferences);
+
+	if (!ChangedReferences.IsEmpty())
+	{
+		OnUnsavedReferencesChanged.ExecuteIfBound(Package->GetFName(), ChangedReferences);
+	}
+}
+
+bool FRefExplorerUnsavedReferenceScanner::Tick(float DeltaTime)
+{
+	// Objects can only be serialized on the game thread, so the scan is spread over frames instead
+	const double EndTime = FPlatformTime::Seconds() + FRefExplorerEditorModule_PRIVATE::UNSAVED_REFERENCES_FRAME_BUDGET;
+
+	do
+	{
+		if (!ScanningPackage.IsValid() || ScanningObjectIdx >= ScanningObjects.Num())
+		{
+			if (ScanningPackage.IsValid())
+			{
+				FinishPackage();
+				OnScanningChanged.ExecuteIfBound();
+			}
+
+			if (!StartNextPackage())
+			{
+				TickerHandle.Reset();
+				OnScanningChanged.ExecuteIfBound();
+				return false;
+			}
+		}
+		else if (UObject* Object = ScanningObjects[ScanningObjectIdx++].Get())
+		{
+			FRefExplorerEditorModule_PRIVATE::FPackageReferenceCollector(ScanningPackage.Get(), ScanningReferences).Collect(Object);
+		}
+	} while (FPlatformTime::Seconds() < EndTime);
+
+	return true;
+}
+
+//--------------------------------------------------------------------
+// FRefExplorerThumbnailCache
+//--------------------------------------------------------------------
+
+TSharedRef<FRefExplorerThumbnailCache> FRefExplorerThumbnailCache::Get()
+{
+	static TWeakPtr<FRefExplorerThumbnailCache> WeakThumbnailCache;
+
+	if (TSharedPtr<FRefExplorerThumbnailCache> ThumbnailCache = WeakThumbnailCache.Pin())
+	{
+		return ThumbnailCache.ToSharedRef();
+	}
+
+	TSharedRef<FRefExplorerThumbnailCache> ThumbnailCache = MakeShared<FRefExplorerThumbnailCache>();
+	WeakThumbnailCache = ThumbnailCache;
+
+	return ThumbnailCache;
+}
+
+FRefExplorerThumbnailCache::FRefExplorerThumbnailCache()
+	: Thumbnails(FRefExplorerEditorModule_PRIVATE::THUMBNAIL_MEMORY_BUDGET / FRefExplorerEditorModule_PRIVATE::GetThumbnailBytes(FRefExplorerEditorModule_PRIVATE::THUMBNAIL_MIN_RESOLUTION))
+	, UsedBytes(0)
+{
+	// Enough textures for the budget at full resolution
+	Pool = MakeShareable(new FAssetThumbnailPool(FRefExplorerEditorModule_PRIVATE::THUMBNAIL_MEMORY_BUDGET / FRefExplorerEditorModule_PRIVATE::GetThumbnailBytes(FRefExplorerEditorModule_PRIVATE::THUMBNAIL_MAX_RESOLUTION)));
+}
+
+TSharedRef<FAssetThumbnail> FRefExplorerThumbnailCache::FindOrCreate(const FAssetData& AssetData, uint32 Resolution)
+{
+	const FThumbnailKey Key(AssetData.GetSoftObjectPath(), Resolution);
+
+	if (TSharedPtr<FAssetThumbnail>* Thumbnail = Thumbnails.FindAndTouch(Key))
+	{
+		return Thumbnail->ToSharedRef();
+	}
+
+	// Evicted thumbnails stay alive while nodes still show them, the pool frees their textures after that
+	while (Thumbnails.Num() > 0 && UsedBytes + FRefExplorerEditorModule_PRIVATE::GetThumbnailBytes(Resolution) > FRefExplorerEditorModule_PRIVATE::THUMBNAIL_MEMORY_BUDGET)
+	{
+		UsedBytes -= FRefExplorerEditorModule_PRIVATE::GetThumbnailBytes(Thumbnails.RemoveLeastRecent()->GetSize().X);
+	}
+
+	TSharedRef<FAssetThumbnail> Thumbnail = MakeShared<FAssetThumbnail>(AssetData, Resolution, Resolution, Pool);
+
+	Thumbnails.Add(Key, Thumbnail);
+	UsedBytes += FRefExplorerEditorModule_PRIVATE::GetThumbnailBytes(Resolution);
+
+	return Thumbnail;
+}
+
+void FRefExplorerThumbnailCache::Prioritize(const TArray<TSharedPtr<FAssetThumbnail>>& InThumbnails)
+{
+	// The pool prioritizes thumbnails of one size at a time
+	TMap<uint32, TArray<TSharedPtr<FAssetThumbnail>>> ThumbnailsByResolution;
+
+	for (const TSharedPtr<FAssetThumbnail>& Thumbnail : InThumbnails)
+	{
+		ThumbnailsByResolution.FindOrAdd(Thumbnail->GetSize().X).Add(Thumbnail);
+	}
+
+	for (const TPair<uint32, TArray<TSharedPtr<FAssetThumbnail>>>& Pair : ThumbnailsByResolution)
+	{
+		Pool->PrioritizeThumbnails(Pair.Value, Pair.Key, Pair.Key);
+	}
+}
+
+//--------------------------------------------------------------------
+// FRefExplorerLiteGraph
+//--------------------------------------------------------------------
+
+void FRefExplorerLiteGraph::Reset()
+{
+	Nodes.Reset();
+	Edges.Reset();
+	Bounds.Init();
+}
+
+int32 FRefExplorerLiteGraph::FindNodeAt(const FVector2D& Location) const
+{
+	// Only used on clicks, so a linear search is fine
+	for (int32 NodeIndex = Nodes.Num() - 1; NodeIndex >= 0; NodeIndex--)
+	{
+		if (FBox2D(Nodes[NodeIndex].Position, Nodes[NodeIndex].Position + FRefExplorerEditorModule_PRIVATE::LITE_NODE_SIZE).IsInside(Location))
+		{
+			return NodeIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+//--------------------------------------------------------------------
+// UEdGraph_RefExplorer
+//--------------------------------------------------------------------
+
+UEdGraph_RefExplorer::UEdGraph_RefExplorer(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	if (!IsTemplate())
+	{
+		ThumbnailCache = FRefExplorerThumbnailCache::Get();
+
+		if (GEditor)
+		{
+			BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddUObject(this, &UEdGraph_RefExplorer::OnBlueprintPreCompile);
+			BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddUObject(this, &UEdGraph_RefExplorer::OnBlueprintCompiled);
+		}
+
+		ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddUObject(this, &UEdGraph_RefExplorer::OnObjectsReplaced);
+		PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddUObject(this, &UEdGraph_RefExplorer::OnPackageSaved);
+	}
+
+	bReadPropertiesFromDisk = false;
+	bShowPropertyPins = false;
+	RebuildSerial = 0;
+	LayoutMode = FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode::Layered;
+	bKeepNodePositions = true;
+	bClusterReferencers = true;
+	bSpatialIndexDirty = true;
+	LayoutVersion = 0;
+	NodeBuildQueueHead = 0;
+	PopulateStartTime = 0.0;
+	LastPopulateSeconds = 0.0;
+	PropertyPinQueueHead = 0;
+	NodeWidgetPoolCursor = 0;
+	NodeWidgetPoolWrapFrame = 0;
+	LayoutCacheNodeSetHash = 0;
+	bLayoutCacheDirty = false;
+	bLayoutApplied = false;
+}
+
+void UEdGraph_RefExplorer::BeginDestroy()
+{
+	NodeWidgetPool.Empty();
+	ThumbnailCache.Reset();
+	UnsavedReferenceScanner.Reset();
+	CancelLayout();
+	StopPopulating();
+	StopPropertyPins();
+
+	if (GEditor)
+	{
+		GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+	Super::BeginDestroy();
+}
+
+void UEdGraph_RefExplorer::SetGraphRoot(const FAssetIdentifier& GraphRootIdentifier, const FIntPoint& GraphRootOrigin)
+{
+	if (CurrentGraphRootIdentifier != GraphRootIdentifier)
+	{
+		RefPropInfos.Reset();
+		SkippedWhileCompiling.Reset();
+		ExpandedClusters.Reset();
+	}
+
+	CurrentGraphRootIdentifier = GraphRootIdentifier;
+	CurrentGraphRootOrigin = GraphRootOrigin;
+	UAssetManager::Get().UpdateManagementDatabase();
+}
+
+UEdGraphNode_RefExplorer* UEdGraph_RefExplorer::RebuildGraph(bool bForceRelayout)
+{
+	FlushLayoutCache();
+
+	// Positions the user already got used to, or moved nodes to. Nodes still waiting for their layout are at temporary positions
+	TMap<FAssetIdentifier, FIntPoint> PreviousPositions;
+
+	if (bKeepNodePositions && !bForceRelayout && IsPopulating() && BuiltGraphRootIdentifier == CurrentGraphRootIdentifier)
+	{
+		// Previous build never got to place its nodes, the positions it was going to restore still apply
+		PreviousPositions = MoveTemp(PopulatePreviousPositions);
+	}
+	else if (bKeepNodePositions && !bForceRelayout && bLayoutApplied && BuiltGraphRootIdentifier == CurrentGraphRootIdentifier)
+	{
+		for (UEdGraphNode* Node : Nodes)
+		{
+			if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node))
+			{
+				PreviousPositions.Add(RefExplorerNode->GetIdentifier(), FIntPoint(RefExplorerNode->NodePosX, RefExplorerNode->NodePosY));
+			}
+		}
+	}
+
+	RemoveAllNodes();
+
+	RebuildSerial++;
+	CancelLayout();
+	MarkSpatialIndexDirty();
+
+	RefExplorerNodeInfos.Reset();
+	RefExplorerNodeInfos.FindOrAdd(CurrentGraphRootIdentifier, FRefExplorerNodeInfo(CurrentGraphRootIdentifier));
+
+	TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory> ReferenceLinks;
+	GetSortedLinks(CurrentGraphRootIdentifier, ReferenceLinks);
+
+	UnsavedRootLinks.Reset();
+
+	if (UnsavedReferenceScanner)
+	{
+		AddUnsavedLinks(CurrentGraphRootIdentifier, ReferenceLinks);
+
+		for (const TPair<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& Pair : ReferenceLinks)
+		{
+			if (!!(Pair.Value & FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkStateMask))
+			{
+				UnsavedRootLinks.Add(Pair.Key.PackageName, Pair.Value);
+			}
+		}
+	}
+
+	TMap<FAssetIdentifier, TArray<FAssetIdentifier>> ClusterMembers;
+
+	if (bClusterReferencers && ReferenceLinks.Num() > FRefExplorerEditorModule_PRIVATE::CLUSTER_THRESHOLD)
+	{
+		ClusterLinks(ReferenceLinks, ClusterMembers);
+	}
+
+	RefExplorerNodeInfos[CurrentGraphRootIdentifier].Children.Reserve(ReferenceLinks.Num());
+
+	for (const TPair<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& Pair : ReferenceLinks)
+	{
+		const FAssetIdentifier ChildId = Pair.Key;
+
+		if (!RefExplorerNodeInfos.Contains(ChildId))
+		{
+			FRefExplorerNodeInfo& NewNodeInfo = RefExplorerNodeInfos.FindOrAdd(ChildId, FRefExplorerNodeInfo(ChildId));
+			RefExplorerNodeInfos[ChildId].Parents.FindOrAdd(CurrentGraphRootIdentifier);
+			RefExplorerNodeInfos[CurrentGraphRootIdentifier].Children.Emplace(Pair);
+		}
+		else if (!RefExplorerNodeInfos[ChildId].Parents.Contains(CurrentGraphRootIdentifier))
+		{
+			RefExplorerNodeInfos[ChildId].Parents.FindOrAdd(CurrentGraphRootIdentifier);
+			RefExplorerNodeInfos[CurrentGraphRootIdentifier].Children.Emplace(Pair);
+		}
+	}
+
+	for (TPair<FAssetIdentifier, TArray<FAssetIdentifier>>& Pair : ClusterMembers)
+	{
+		RefExplorerNodeInfos[Pair.Key].ClusterMembers = MoveTemp(Pair.Value);
+	}
+
+	UpdateLayoutCacheKey();
+
+	TSet<FName> AllPackageNames;
+
+	for (TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : RefExplorerNodeInfos)
+	{
+		if (!InfoPair.Key.IsValue() && !InfoPair.Key.PackageName.IsNone())
+		{
+			AllPackageNames.Add(InfoPair.Key.PackageName);
+		}
+	}
+
+	TMap<FName, FAssetData> PackagesToAssetDataMap;
+	UE::AssetRegistry::GetAssetForPackages(AllPackageNames.Array(), PackagesToAssetDataMap);
+
+	TSet<FTopLevelAssetPath> AllClasses;
+	for (TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : RefExplorerNodeInfos)
+	{
+		InfoPair.Value.AssetData = PackagesToAssetDataMap.FindRef(InfoPair.Key.PackageName);
+		if (InfoPair.Value.AssetData.IsValid())
+		{
+			AllClasses.Add(InfoPair.Value.AssetData.AssetClassPath);
+		}
+	}
+
+	if (RefExplorerNodeInfos.Num() > FRefExplorerEditorModule_PRIVATE::LITE_GRAPH_THRESHOLD)
+	{
+		// Graph node objects, their pins and widgets cost too much at this size
+		BuildLiteGraph();
+
+		NotifyGraphChanged();
+		NotifyStatusChanged();
+
+		return nullptr;
+	}
+
+	UEdGraphNode_RefExplorer* RootNode = nullptr;
+
+	if (!RefExplorerNodeInfos.IsEmpty())
+	{
+		const FRefExplorerNodeInfo& NodeInfo = RefExplorerNodeInfos[CurrentGraphRootIdentifier];
+		RootNode = Cast<UEdGraphNode_RefExplorer>(CreateNode(UEdGraphNode_RefExplorer::StaticClass(), false));
+		RootNode->SetupRefExplorerNode(CurrentGraphRootOrigin, CurrentGraphRootIdentifier, NodeInfo.AssetData);
+
+		// References
+		BeginCreateNodes(RootNode);
+
+		if (NodeBuildQueue.Num() > FRefExplorerEditorModule_PRIVATE::POPULATE_PROGRESSIVE_THRESHOLD)
+		{
+			// Nodes are queued by importance, so the first frames already show the referencers that matter most
+			PopulatePreviousPositions = MoveTemp(PreviousPositions);
+			PopulateStartTime = FPlatformTime::Seconds();
+
+			if (TickPopulate(0.f))
+			{
+				PopulateTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UEdGraph_RefExplorer::TickPopulate));
+			}
+
+			// Added nodes are announced one by one, refreshing the whole panel here would recreate them every frame
+			return RootNode;
+		}
+
+		CreateQueuedNodes();
+		FinishCreateNodes(PreviousPositions);
+	}
+
+	NotifyGraphChanged();
+	NotifyStatusChanged();
+
+	return RootNode;
+}
+
+bool UEdGraph_RefExplorer::TickPopulate(float DeltaTime)
+{
+	const double EndTime = FPlatformTime::Seconds() + FRefExplorerEditorModule_PRIVATE::POPULATE_FRAME_BUDGET;
+
+	do
+	{
+		if (CreateQueuedNodes(FRefExplorerEditorModule_PRIVATE::POPULATE_BATCH_SIZE))
+		{
+			PopulateTickerHandle.Reset();
+			LastPopulateSeconds = GetPopulateSeconds();
+
+			FinishCreateNodes(PopulatePreviousPositions);
+			PopulatePreviousPositions.Reset();
+
+			// New pins are only picked up by a full refresh
+			if (bShowPropertyPins)
+			{
+				NotifyGraphChanged();
+			}
+
+			NotifyStatusChanged();
+
+			return false;
+		}
+	} while (FPlatformTime::Seconds() < EndTime);
+
+	NotifyStatusChanged();
+
+	return true;
+}
+
+void UEdGraph_RefExplorer::StopPopulating()
+{
+	if (PopulateTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PopulateTickerHandle);
+		PopulateTickerHandle.Reset();
+	}
+
+	PopulatePreviousPositions.Reset();
+}
+
+void UEdGraph_RefExplorer::FinishCreateNodes(const TMap<FAssetIdentifier, FIntPoint>& PreviousPositions)
+{
+	BuildNodeAggregates();
+
+	if (!PreviousPositions.IsEmpty())
+	{
+		// New nodes are only squeezed in, the cache keeps the last completed layout until the user moves something
+		PlaceNodesIncrementally(PreviousPositions);
+		UpdateSpatialIndex();
+		bLayoutApplied = true;
+	}
+	else
+	{
+		// Nodes stay on their arcs until the cached layout is read, or laid out if there is none
+		LoadLayoutCache();
+	}
+
+	BuiltGraphRootIdentifier = CurrentGraphRootIdentifier;
+	LastExpandedClusterPath.Reset();
+
+	if (bReadPropertiesFromDisk)
+	{
+		GatherRefPropInfosFromDisk();
+	}
+
+	if (bShowPropertyPins)
+	{
+		CreatePropertyPins();
+	}
+
+	CheckPendingMapPackages();
+}
+
+bool UEdGraph_RefExplorer::FindIsMapPackage(FName PackageName, bool& bOutIsMapPackage)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TOptional<FAssetPackageData> AssetPackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+	if (AssetPackageData.IsSet())
+	{
+		bOutIsMapPackage = (AssetPackageData->Flags & PKG_ContainsMap) != 0;
+		return true;
+	}
+
+	if (const bool* bIsMapPackage = FRefExplorerEditorModule_PRIVATE::MapPackagesOnDisk.Find(PackageName))
+	{
+		bOutIsMapPackage = *bIsMapPackage;
+		return true;
+	}
+
+	PendingMapPackages.Add(PackageName);
+	return false;
+}
+
+void UEdGraph_RefExplorer::CheckPendingMapPackages()
+{
+	if (PendingMapPackages.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FName> PackageNames = PendingMapPackages.Array();
+	PendingMapPackages.Reset();
+
+	TWeakObjectPtr<UEdGraph_RefExplorer> WeakGraph(this);
+	const uint32 Serial = RebuildSerial;
+
+	Async(EAsyncExecution::ThreadPool, [WeakGraph, Serial, PackageNames = MoveTemp(PackageNames)]()
+		{
+			TBitArray<> IsMapPackage(false, PackageNames.Num());
+
+			for (int32 Index = 0; Index < PackageNames.Num(); Index++)
+			{
+				const FString PotentiallyMapFilename = FPackageName::LongPackageNameToFilename(PackageNames[Index].ToString(), FPackageName::GetMapPackageExtension());
+				IsMapPackage[Index] = FPlatformFileManager::Get().GetPlatformFile().FileExists(*PotentiallyMapFilename);
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [WeakGraph, Serial, PackageNames, IsMapPackage]()
+				{
+					bool bAnyMapPackage = false;
+
+					for (int32 Index = 0; Index < PackageNames.Num(); Index++)
+					{
+						FRefExplorerEditorModule_PRIVATE::MapPackagesOnDisk.Add(PackageNames[Index], IsMapPackage[Index]);
+						bAnyMapPackage |= IsMapPackage[Index];
+					}
+
+					UEdGraph_RefExplorer* Graph = WeakGraph.Get();
+
+					if (!bAnyMapPackage || !Graph || Graph->RebuildSerial != Serial)
+					{
+						return;
+					}
+
+					for (const TPair<FAssetIdentifier, UEdGraphNode_RefExplorer*>& NodePair : Graph->BuiltNodes)
+					{
+						if (NodePair.Value->IsPackage() && !NodePair.Value->UsesThumbnail() && FRefExplorerEditorModule_PRIVATE::MapPackagesOnDisk.FindRef(NodePair.Key.PackageName))
+						{
+							NodePair.Value->SetMapPackage();
+						}
+					}
+
+					Graph->NotifyGraphChanged();
+				});
+		});
+}
+
+void UEdGraph_RefExplorer::BuildLiteGraph()
+{
+	LiteGraph.Reset();
+	LiteGraph.Nodes.Reserve(RefExplorerNodeInfos.Num());
+
+	FRefExplorerEditorModule_PRIVATE::FLayoutGraph Layout;
+	TMap<FAssetIdentifier, int32> NodeIndices;
+	NodeIndices.Reserve(RefExplorerNodeInfos.Num());
+
+	auto GetNodeIndex = [&](const FAssetIdentifier& Identifier)
+		{
+			if (const int32* NodeIndex = NodeIndices.Find(Identifier))
+			{
+				return *NodeIndex;
+			}
+
+			FRefExplorerLiteNode& Node = LiteGraph.Nodes.AddDefaulted_GetRef();
+			Node.Identifier = Identifier;
+			Node.Color = FLinearColor(0.55f, 0.55f, 0.55f);
+
+			const FRefExplorerNodeInfo* NodeInfo = RefExplorerNodeInfos.Find(Identifier);
+
+			if (NodeInfo && !NodeInfo->ClusterMembers.IsEmpty())
+			{
+				Node.NumClusterMembers = NodeInfo->ClusterMembers.Num();
+				Node.Label = FText::Format(LOCTEXT("LiteClusterLabel", "{0} ({1})"), FText::FromName(Identifier.PackageName), FText::AsNumber(Node.NumClusterMembers));
+				Node.Color = FLinearColor(0.8f, 0.6f, 0.2f);
+			}
+			else if (NodeInfo && NodeInfo->AssetData.IsValid())
+			{
+				Node.Label = FText::FromName(NodeInfo->AssetData.AssetName);
+				Node.Color = FRefExplorerEditorModule_PRIVATE::GetAssetClassPresentation(NodeInfo->AssetData).TypeColor;
+			}
+			else
+			{
+				Node.Label = FText::FromString(Identifier.ToString());
+			}
+
+			Layout.AddNode();
+			return NodeIndices.Add(Identifier, LiteGraph.Nodes.Num() - 1);
+		};
+
+	GetNodeIndex(CurrentGraphRootIdentifier);
+
+	for (const TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : RefExplorerNodeInfos)
+	{
+		const int32 NodeIndex = GetNodeIndex(InfoPair.Key);
+
+		for (const TPair<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& Pair : InfoPair.Value.Children)
+		{
+			const int32 ChildNodeIndex = GetNodeIndex(Pair.Key);
+
+			LiteGraph.Edges.Add({ ChildNodeIndex, NodeIndex, Pair.Value });
+			Layout.Children[NodeIndex].Add(ChildNodeIndex);
+		}
+	}
+
+	BuiltGraphRootIdentifier = CurrentGraphRootIdentifier;
+
+	// Force directed layout does not settle in reasonable time at this size, so the lite graph is always layered
+	TWeakObjectPtr<UEdGraph_RefExplorer> WeakGraph(this);
+	const uint32 Serial = RebuildSerial;
+
+	Async(EAsyncExecution::ThreadPool, [WeakGraph, Serial, Layout = MoveTemp(Layout)]() mutable
+		{
+			FRefExplorerEditorModule_PRIVATE::ComputeLayeredLayout(Layout);
+
+			AsyncTask(ENamedThreads::GameThread, [WeakGraph, Serial, Positions = MoveTemp(Layout.Positions)]()
+				{
+					UEdGraph_RefExplorer* Graph = WeakGraph.Get();
+
+					if (Graph && Graph->RebuildSerial == Serial && Graph->LiteGraph.Nodes.Num() == Positions.Num())
+					{
+						FRefExplorerLiteGraph& LiteGraph = Graph->LiteGraph;
+						LiteGraph.Bounds.Init();
+
+						for (int32 NodeIndex = 0; NodeIndex < Positions.Num(); NodeIndex++)
+						{
+							LiteGraph.Nodes[NodeIndex].Position = FVector2D(Graph->CurrentGraphRootOrigin) + Positions[NodeIndex];
+							LiteGraph.Bounds += LiteGraph.Nodes[NodeIndex].Position;
+							LiteGraph.Bounds += LiteGraph.Nodes[NodeIndex].Position + FRefExplorerEditorModule_PRIVATE::LITE_NODE_SIZE;
+						}
+
+						LiteGraph.LayoutSerial++;
+						Graph->LayoutVersion++;
+					}
+				});
+		});
+}
+
+void UEdGraph_RefExplorer::GetSortedLinks(const FAssetIdentifier& GraphRootIdentifier, TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& OutLinks) const
+{
+	using namespace UE::AssetRegistry;
+	auto CategoryOrder = [](EDependencyCategory InCategory)
+		{
+			switch (InCategory)
+			{
+			case EDependencyCategory::Package:
+			{
+				return 0;
+			}
+			case EDependencyCategory::Manage:
+			{
+				return 1;
+			}
+			case EDependencyCategory::SearchableName:
+			{
+				return 2;
+			}
+			default:
+			{
+				check(false);
+				return 3;
+			}
+			}
+		};
+	auto IsHard = [](EDependencyProperty Properties)
+		{
+			return static_cast<bool>(((Properties & EDependencyProperty::Hard) != EDependencyProperty::None) | ((Properties & EDependencyProperty::Direct) != EDependencyProperty::None));
+		};
 
-	// Shows a list of objects that the selected asset references
-	TSharedPtr<FUICommandInfo> ShowReferencedObjects;
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetDependency> LinksToAsset;
+
+	LinksToAsset.Reset();
+
+	using namespace UE::AssetRegistry;
+	EDependencyCategory Categories = EDependencyCategory::Package | EDependencyCategory::Manage;
+	EDependencyQuery Flags = EDependencyQuery::NoRequirements;
+
+	AssetRegistry.GetReferencers(GraphRootIdentifier, LinksToAsset, Categories, Flags);
+
+	// Sort the links from most important kind of link to least important kind of link, so that if we can't display them all in an ExceedsMaxSearchBreadth test, we
+	// show the most important links.
+	Algo::Sort(LinksToAsset, [&CategoryOrder, &IsHard](const FAssetDependency& A, const FAssetDependency& B)
+		{
+			if (A.Category != B.Category)
+			{
+				return CategoryOrder(A.Category) < CategoryOrder(B.Category);
+			}
+			if (A.Properties != B.Properties)
+			{
+				bool bAIsHard = IsHard(A.Properties);
+				bool bBIsHard = IsHard(B.Properties);
+				if (bAIsHard != bBIsHard)
+				{
+					return bAIsHard;
+				}
+			}
+			return A.AssetId.PackageName.LexicalLess(B.AssetId.PackageName);
+		});
+	for (const FAssetDependency& LinkToAsset : LinksToAsset)
+	{
+		FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory& Category = OutLinks.FindOrAdd(LinkToAsset.AssetId, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkEndActive);
+		bool bIsHard = IsHard(LinkToAsset.Properties);
+		bool bIsUsedInGame = (LinkToAsset.Category != EDependencyCategory::Package) || ((LinkToAsset.Properties & EDependencyProperty::Game) != EDependencyProperty::None);
+		Category |= FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkEndActive;
+		Category |= bIsHard ? FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkTypeHard : FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkTypeNone;
+		Category |= bIsUsedInGame ? FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkTypeUsedInGame : FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkTypeNone;
+	}
+
+	// Check filters and Filter for our registry source
+	
+	TArray<FAssetIdentifier> ReferenceIds;
+	OutLinks.GenerateKeyArray(ReferenceIds);
+	
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+
+	for (int32 Index = 0; Index < ReferenceIds.Num(); Index++)
+	{
+		FName PackageName = ReferenceIds[Index].PackageName;
+
+		if (PackageName != NAME_None)
+		{
+			TOptional<FAssetPackageData> assetPackageData = AssetRegistryModule.Get().GetAssetPackageDataCopy(PackageName);
+
+			if (!assetPackageData.GetPtrOrNull() || assetPackageData.GetPtrOrNull()->DiskSize < 0)
+			{
+				// Remove bad package
+				ReferenceIds.RemoveAt(Index);
+
+				// If this is a redirector replace with references
+				TArray<FAssetData> Assets;
+				AssetRegistryModule.Get().GetAssetsByPackageName(PackageName, Assets, true);
+
+				for (const FAssetData& Asset : Assets)
+				{
+					if (Asset.IsRedirector())
+					{
+						TArray<FAssetIdentifier> FoundReferences;
+
+						AssetRegistryModule.Get().GetReferencers(PackageName, FoundReferences, Categories, Flags);
+
+						ReferenceIds.Insert(FoundReferences, Index);
+						break;
+					}
+				}
+
+				// Need to redo this index, it was either removed or replaced
+				Index--;
+			}
+		}
+	}
+
+	for (TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>::TIterator It(OutLinks); It; ++It)
+	{
+		////// Here was scripts filtering like InAssetIdentifier.PackageName.ToString().StartsWith(TEXT("/Script"))
+		//////if (!IsPackageIdentifierPassingFilter(It.Key()))
+		//////{
+		//////	It.RemoveCurrent();
+		//////}
+		//////else if (!ReferenceIds.Contains(It.Key()))
+		if (!ReferenceIds.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UEdGraph_RefExplorer::AddUnsavedLinks(const FAssetIdentifier& GraphRootIdentifier, TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& OutLinks) const
+{
+	using namespace FRefExplorerEditorModule_PRIVATE;
+
+	if (!GraphRootIdentifier.IsPackage() || GraphRootIdentifier.PackageName.IsNone())
+	{
+		return;
+	}
+
+	for (const TPair<FName, TSet<FName>>& Pair : UnsavedReferenceScanner->GetUnsavedReferences())
+	{
+		if (Pair.Key == GraphRootIdentifier.PackageName)
+		{
+			continue;
+		}
+
+		const FAssetIdentifier ReferencerId(Pair.Key);
+		const bool bReferencesRoot = Pair.Value.Contains(GraphRootIdentifier.PackageName);
+
+		if (EDependencyPinCategory* Category = OutLinks.Find(ReferencerId))
+		{
+			if (!bReferencesRoot)
+			{
+				*Category |= EDependencyPinCategory::LinkStateRemoved;
+			}
+		}
+		else if (bReferencesRoot)
+		{
+			OutLinks.Add(ReferencerId, EDependencyPinCategory::LinkEndActive | EDependencyPinCategory::LinkStateUnsaved);
+		}
+	}
+}
+
+void UEdGraph_RefExplorer::ClusterLinks(TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& InOutLinks, TMap<FAssetIdentifier, TArray<FAssetIdentifier>>& OutClusterMembers) const
+{
+	using namespace FRefExplorerEditorModule_PRIVATE;
+
+	TArray<FString> LinkClusterPaths;
+	LinkClusterPaths.Reserve(InOutLinks.Num());
+
+	TMap<FString, int32> ClusterSizes;
+
+	for (const TPair<FAssetIdentifier, EDependencyPinCategory>& Link : InOutLinks)
+	{
+		FString& ClusterPath = LinkClusterPaths.Emplace_GetRef();
+
+		if (Link.Key.IsPackage())
+		{
+			ClusterPath = GetClusterPath(Link.Key.PackageName.ToString(), ExpandedClusters);
+		}
+
+		if (!ClusterPath.IsEmpty())
+		{
+			ClusterSizes.FindOrAdd(ClusterPath)++;
+		}
+	}
+
+	// Links keep their sorted order, a cluster takes the place of its first member
+	TMap<FAssetIdentifier, EDependencyPinCategory> ClusteredLinks;
+	TMap<FAssetIdentifier, TMap<EDependencyPinCategory, int32>> ClusterCategoryCounts;
+
+	int32 LinkIdx = 0;
+
+	for (const TPair<FAssetIdentifier, EDependencyPinCategory>& Link : InOutLinks)
+	{
+		const FString& ClusterPath = LinkClusterPaths[LinkIdx++];
+
+		// Lone referencers are not worth a cluster
+		if (ClusterPath.IsEmpty() || ClusterSizes[ClusterPath] < 2)
+		{
+			ClusteredLinks.Add(Link.Key, Link.Value);
+			continue;
+		}
+
+		const FAssetIdentifier ClusterId(FName(*ClusterPath), NAME_None, CLUSTER_VALUE_NAME);
+
+		ClusteredLinks.FindOrAdd(ClusterId, Link.Value);
+		OutClusterMembers.FindOrAdd(ClusterId).Add(Link.Key);
+		ClusterCategoryCounts.FindOrAdd(ClusterId).FindOrAdd(Link.Value)++;
+	}
+
+	// Clusters are linked with the most common category of their members
+	for (const TPair<FAssetIdentifier, TMap<EDependencyPinCategory, int32>>& Pair : ClusterCategoryCounts)
+	{
+		int32 MaxCount = 0;
+
+		for (const TPair<EDependencyPinCategory, int32>& CategoryCount : Pair.Value)
+		{
+			if (CategoryCount.Value > MaxCount)
+			{
+				MaxCount = CategoryCount.Value;
+				ClusteredLinks[Pair.Key] = CategoryCount.Key;
+			}
+		}
+	}
+
+	InOutLinks = MoveTemp(ClusteredLinks);
+}
+
+void UEdGraph_RefExplorer::ExpandCluster(UEdGraphNode_RefExplorer* ClusterNode)
+{
+	ExpandCluster(ClusterNode->GetIdentifier(), FIntPoint(ClusterNode->NodePosX, ClusterNode->NodePosY));
+}
+
+void UEdGraph_RefExplorer::ExpandCluster(const FAssetIdentifier& ClusterIdentifier, const FIntPoint& ClusterLoc)
+{
+	LastExpandedClusterPath = ClusterIdentifier.PackageName.ToString();
+	LastExpandedClusterLoc = ClusterLoc;
+
+	ExpandedClusters.Add(LastExpandedClusterPath);
+	RebuildGraph();
+}
+
+void UEdGraph_RefExplorer::SetShowUnsavedReferences(bool bInShowUnsavedReferences)
+{
+	if (bInShowUnsavedReferences && !UnsavedReferenceScanner)
+	{
+		UnsavedReferenceScanner = MakeUnique<FRefExplorerUnsavedReferenceScanner>();
+		UnsavedReferenceScanner->OnUnsavedReferencesChanged.BindUObject(this, &UEdGraph_RefExplorer::OnUnsavedReferencesChanged);
+		UnsavedReferenceScanner->OnScanningChanged.BindUObject(this, &UEdGraph_RefExplorer::NotifyStatusChanged);
+	}
+	else if (!bInShowUnsavedReferences)
+	{
+		UnsavedReferenceScanner.Reset();
+	}
+}
+
+void UEdGraph_RefExplorer::NotifyStatusChanged() const
+{
+	if (TSharedPtr<SRefExplorer> RefExplorerPtr = RefExplorer.Pin())
+	{
+		RefExplorerPtr->UpdateStatusText();
+	}
+}
+
+void UEdGraph_RefExplorer::OnUnsavedReferencesChanged(FName PackageName, const TSet<FName>& ChangedReferences)
+{
+	using namespace FRefExplorerEditorModule_PRIVATE;
+
+	// Only edges to the root are shown, other changes do not affect the graph
+	if (!CurrentGraphRootIdentifier.IsPackage() || !ChangedReferences.Contains(CurrentGraphRootIdentifier.PackageName) || !UnsavedReferenceScanner)
+	{
+		return;
+	}
+
+	// First scan of a package reports all of its references as changed, most of them are saved already
+	TArray<FAssetIdentifier> SavedDependencies;
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().GetDependencies(FAssetIdentifier(PackageName), SavedDependencies, UE::AssetRegistry::EDependencyCategory::Package);
+
+	const bool bSavedLink = SavedDependencies.Contains(FAssetIdentifier(CurrentGraphRootIdentifier.PackageName));
+
+	const TSet<FName>* UnsavedReferences = UnsavedReferenceScanner->GetUnsavedReferences().Find(PackageName);
+	const bool bUnsavedLink = UnsavedReferences && UnsavedReferences->Contains(CurrentGraphRootIdentifier.PackageName);
+
+	EDependencyPinCategory LinkState = EDependencyPinCategory::LinkStateSaved;
+
+	if (bSavedLink && UnsavedReferences && !bUnsavedLink)
+	{
+		LinkState = EDependencyPinCategory::LinkStateRemoved;
+	}
+	else if (!bSavedLink && bUnsavedLink)
+	{
+		LinkState = EDependencyPinCategory::LinkStateUnsaved;
+	}
+
+	const EDependencyPinCategory* ShownCategory = UnsavedRootLinks.Find(PackageName);
+	const EDependencyPinCategory ShownLinkState = ShownCategory ? (*ShownCategory & EDependencyPinCategory::LinkStateMask) : EDependencyPinCategory::LinkStateSaved;
+
+	if (LinkState != ShownLinkState)
+	{
+		RebuildGraph();
+	}
+}
+
+void UEdGraph_RefExplorer::GatherAssetData(TMap<FAssetIdentifier, FRefExplorerNodeInfo>& InNodeInfos)
+{
+	// Grab the list of packages
+	TSet<FName> PackageNames;
+	for (TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : InNodeInfos)
+	{
+		FAssetIdentifier& AssetId = InfoPair.Key;
+		if (!AssetId.IsValue() && !AssetId.PackageName.IsNone())
+		{
+			PackageNames.Add(AssetId.PackageName);
+		}
+	}
+
+	// Retrieve the AssetData from the Registry
+	TMap<FName, FAssetData> PackagesToAssetDataMap;
+	UE::AssetRegistry::GetAssetForPackages(PackageNames.Array(), PackagesToAssetDataMap);
+
+
+	// Populate the AssetData back into the NodeInfos
+	for (TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : InNodeInfos)
+	{
+		InfoPair.Value.AssetData = PackagesToAssetDataMap.FindRef(InfoPair.Key.PackageName);
+	}
+}
+
+void UEdGraph_RefExplorer::BeginCreateNodes(UEdGraphNode_RefExplorer* RootNode)
+{
+	NodeBuildQueue.Reset(RefExplorerNodeInfos.Num());
+	NodeBuildQueueHead = 0;
+
+	BuiltNodes.Reset();
+	BuiltNodes.Reserve(RefExplorerNodeInfos.Num());
+	BuiltNodes.Add(CurrentGraphRootIdentifier, RootNode);
+
+	Nodes.Reserve(RefExplorerNodeInfos.Num());
+
+	QueueChildNodes(CurrentGraphRootIdentifier, CurrentGraphRootOrigin);
+}
+
+bool UEdGraph_RefExplorer::CreateQueuedNodes(int32 MaxNodes)
+{
+	int32 NumCreatedNodes = 0;
+
+	while (NodeBuildQueueHead < NodeBuildQueue.Num() && NumCreatedNodes < MaxNodes)
+	{
+		// Copied, queueing children may reallocate the queue
+		const FRefExplorerNodeBuildItem BuildItem = NodeBuildQueue[NodeBuildQueueHead++];
+
+		UEdGraphNode_RefExplorer* ParentNode = BuiltNodes.FindRef(BuildItem.ParentId);
+		UEdGraphNode_RefExplorer*& Node = BuiltNodes.FindOrAdd(BuildItem.AssetId);
+
+		// Shared children and cycles are wired to the existing node and not expanded again
+		const bool bIsNewNode = Node == nullptr;
+
+		if (bIsNewNode)
+		{
+			const FRefExplorerNodeInfo& NodeInfo = RefExplorerNodeInfos[BuildItem.AssetId];
+
+			Node = Cast<UEdGraphNode_RefExplorer>(CreateNode(UEdGraphNode_RefExplorer::StaticClass(), false));
+
+			if (NodeInfo.ClusterMembers.IsEmpty())
+			{
+				Node->SetupRefExplorerNode(BuildItem.NodeLoc, BuildItem.AssetId, NodeInfo.AssetData);
+			}
+			else
+			{
+				Node->SetupClusterNode(BuildItem.NodeLoc, BuildItem.AssetId, NodeInfo.ClusterMembers.Num());
+			}
 
-	// Shows a list of objects that reference the selected asset
-	TSharedPtr<FUICommandInfo> ShowReferencingObjects;
+			NumCreatedNodes++;
+		}
 
-	// Shows a reference tree for the selected asset
-	TSharedPtr<FUICommandInfo> ShowReferenceTree;
+		if (ensure(ParentNode))
+		{
+			Node->SetDependencyPinCategory(BuildItem.Category);
+			ParentNode->AddReferencer(Node);
+		}
 
-	/** Zoom in to fit the selected objects in the window */
-	TSharedPtr<FUICommandInfo> ZoomToFit;
-};
+		if (bIsNewNode)
+		{
+			QueueChildNodes(BuildItem.AssetId, BuildItem.NodeLoc);
+		}
+	}
 
-//--------------------------------------------------------------------
-// FRefExplorerConnectionDrawingPolicy
-//--------------------------------------------------------------------
+	return NodeBuildQueueHead >= NodeBuildQueue.Num();
+}
 
-class FRefExplorerConnectionDrawingPolicy : public FConnectionDrawingPolicy
+void UEdGraph_RefExplorer::QueueChildNodes(const FAssetIdentifier& InAssetId, const FIntPoint& InNodeLoc)
 {
-public:
-	FRefExplorerConnectionDrawingPolicy(int32 InBackLayerID, int32 InFrontLayerID, float InZoomFactor, const FSlateRect& InClippingRect, FSlateWindowElementList& InDrawElements)
-		: FConnectionDrawingPolicy(InBackLayerID, InFrontLayerID, InZoomFactor, InClippingRect, InDrawElements)
-	{}
+	const TArray<TPair<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>>& Children = RefExplorerNodeInfos[InAssetId].Children;
+	const int32 NumChildren = Children.Num();
 
-	virtual FVector2D ComputeSplineTangent(const FVector2D& Start, const FVector2D& End) const override
+	if (NumChildren == 0)
 	{
-		const int32 Tension = FMath::Abs<int32>(Start.X - End.X);
-		return Tension * FVector2D(1.0f, 0);
+		return;
 	}
 
-	virtual void DetermineWiringStyle(UEdGraphPin* OutputPin, UEdGraphPin* InputPin, /*inout*/ FConnectionParams& Params) override
+	const int32 WidthStep = 256;
+	const int32 HeightStep = 400;
+
+	const float DeltaAngle = UE_PI / NumChildren;
+	const float LastAngle = DeltaAngle * (NumChildren == 1 ? 0 : (NumChildren - 1));
+	const float Radius = HeightStep / FMath::Max(FMath::Abs(1 - FMath::Cos(DeltaAngle)), FMath::Abs(FMath::Sin(DeltaAngle)));
+
+	for (int32 ChildIdx = 0; ChildIdx < NumChildren; ChildIdx++)
 	{
-		FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory OutputCategory = FRefExplorerEditorModule_PRIVATE::ParseDependencyPinCategory(OutputPin->PinType.PinCategory);
-		FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory InputCategory = FRefExplorerEditorModule_PRIVATE::ParseDependencyPinCategory(InputPin->PinType.PinCategory);
+		const float AccumAngle = ChildIdx * DeltaAngle;
 
-		FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory Category = !!(OutputCategory & FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkEndActive) ? OutputCategory : InputCategory;
-		Params.WireColor = GetColor(Category);
+		FIntPoint ChildLoc;
+		ChildLoc.X = InNodeLoc.X - (FMath::Min(ChildIdx, NumChildren - ChildIdx - 1) + 1) * WidthStep;
+		ChildLoc.Y = InNodeLoc.Y - Radius * FMath::Sin(AccumAngle + (UE_PI - LastAngle / 2));
+
+		NodeBuildQueue.Add({ Children[ChildIdx].Key, InAssetId, ChildLoc, Children[ChildIdx].Value });
 	}
-};
+}
 
-//--------------------------------------------------------------------
-// URefExplorerSchema
-//--------------------------------------------------------------------
+void UEdGraph_RefExplorer::LayoutGraph()
+{
+	FRefExplorerEditorModule_PRIVATE::FLayoutGraph Layout;
+	TArray<FAssetIdentifier> LayoutIdentifiers;
+	TMap<FAssetIdentifier, int32> LayoutIndices;
 
-URefExplorerSchema::URefExplorerSchema(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+	LayoutIdentifiers.Reserve(RefExplorerNodeInfos.Num());
+	LayoutIndices.Reserve(RefExplorerNodeInfos.Num());
 
-void URefExplorerSchema::GetContextMenuActions(UToolMenu* Menu, UGraphNodeContextMenuContext* Context) const
-{
+	auto GetLayoutIndex = [&](const FAssetIdentifier& Identifier)
+		{
+			if (const int32* LayoutIndex = LayoutIndices.Find(Identifier))
+			{
+				return *LayoutIndex;
+			}
+
+			LayoutIdentifiers.Add(Identifier);
+			return LayoutIndices.Add(Identifier, Layout.AddNode());
+		};
+
+	GetLayoutIndex(CurrentGraphRootIdentifier);
+
+	for (const TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : RefExplorerNodeInfos)
 	{
-		FToolMenuSection& Section = Menu->AddSection(TEXT("Asset"), NSLOCTEXT("RefExplorerSchema", "AssetSectionLabel", "Asset"));
-		Section.AddMenuEntry(FGlobalEditorCommonCommands::Get().FindInContentBrowser);
-		Section.AddMenuEntry(FRefExplorerCommands::Get().OpenSelectedInAssetEditor);
+		const int32 LayoutIndex = GetLayoutIndex(InfoPair.Key);
+
+		for (const TPair<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& Pair : InfoPair.Value.Children)
+		{
+			const int32 ChildLayoutIndex = GetLayoutIndex(Pair.Key);
+			Layout.Children[LayoutIndex].Add(ChildLayoutIndex);
+		}
 	}
 
+	TWeakObjectPtr<UEdGraph_RefExplorer> WeakGraph(this);
+	const uint32 Serial = RebuildSerial;
+	const FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode Mode = LayoutMode;
+	const TSharedRef<const TArray<FAssetIdentifier>, ESPMode::ThreadSafe> SharedLayoutIdentifiers = MakeShared<const TArray<FAssetIdentifier>, ESPMode::ThreadSafe>(MoveTemp(LayoutIdentifiers));
+
+	CancelLayout();
+	LayoutCancelled = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+
+	Async(EAsyncExecution::ThreadPool, [WeakGraph, Serial, Mode, Cancelled = LayoutCancelled.ToSharedRef(), Layout = MoveTemp(Layout), SharedLayoutIdentifiers]() mutable
+		{
+			auto PostLayout = [&](const TArray<FVector2D>& Positions, bool bZoomToFit, bool bIsFinal)
+				{
+					AsyncTask(ENamedThreads::GameThread, [WeakGraph, Serial, Positions, SharedLayoutIdentifiers, bZoomToFit, bIsFinal]()
+						{
+							UEdGraph_RefExplorer* Graph = WeakGraph.Get();
+
+							if (Graph && Graph->RebuildSerial == Serial)
+							{
+								Graph->ApplyLayout(*SharedLayoutIdentifiers, Positions, bZoomToFit, bIsFinal);
+							}
+						});
+				};
+
+			FRefExplorerEditorModule_PRIVATE::ComputeLayeredLayout(Layout);
+
+			if (Mode == FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode::ForceDirected)
+			{
+				// Layered positions are a good starting point, intermediate positions are streamed so the graph settles on screen
+				PostLayout(Layout.Positions, true, false);
+
+				FRefExplorerEditorModule_PRIVATE::ComputeForceDirectedLayout(Layout, *Cancelled, [&](const FRefExplorerEditorModule_PRIVATE::FLayoutGraph& Progress) { PostLayout(Progress.Positions, false, false); });
+			}
+
+			if (!*Cancelled)
+			{
+				PostLayout(Layout.Positions, true, true);
+			}
+		});
+}
+
+void UEdGraph_RefExplorer::PlaceNodesIncrementally(const TMap<FAssetIdentifier, FIntPoint>& PreviousPositions)
+{
+	// Footprint of a node with spacing around it, same as the layouts use
+	const FVector2D NodeSize(FRefExplorerEditorModule_PRIVATE::LAYOUT_COLUMN_SPACING, FRefExplorerEditorModule_PRIVATE::LAYOUT_ROW_SPACING);
+
+	FRefExplorerSpatialIndex SpatialIndex(FMath::Max(NodeSize.X, NodeSize.Y));
+	TMap<FAssetIdentifier, UEdGraphNode_RefExplorer*> PlacedNodes;
+	TArray<UEdGraphNode_RefExplorer*> NewNodes;
+
+	for (UEdGraphNode* Node : Nodes)
 	{
-		FToolMenuSection& Section = Menu->AddSection(TEXT("Misc"), NSLOCTEXT("RefExplorerSchema", "MiscSectionLabel", "Misc"));
-		Section.AddMenuEntry(FRefExplorerCommands::Get().ZoomToFit);
+		if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node))
+		{
+			if (const FIntPoint* PreviousPosition = PreviousPositions.Find(RefExplorerNode->GetIdentifier()))
+			{
+				RefExplorerNode->NodePosX = PreviousPosition->X;
+				RefExplorerNode->NodePosY = PreviousPosition->Y;
+
+				SpatialIndex.Add(FBox2D(FVector2D(*PreviousPosition), FVector2D(*PreviousPosition) + NodeSize));
+				PlacedNodes.Add(RefExplorerNode->GetIdentifier(), RefExplorerNode);
+			}
+			else
+			{
+				NewNodes.Add(RefExplorerNode);
+			}
+		}
 	}
 
+	// Nodes are created parents first, so every new node has its parent placed already
+	for (UEdGraphNode_RefExplorer* NewNode : NewNodes)
 	{
-		FToolMenuSection& Section = Menu->AddSection(TEXT("References"), NSLOCTEXT("RefExplorerSchema", "ReferencesSectionLabel", "References"));
-		Section.AddMenuEntry(FRefExplorerCommands::Get().CopyReferencedObjects);
-		Section.AddMenuEntry(FRefExplorerCommands::Get().CopyReferencingObjects);
-		Section.AddMenuEntry(FRefExplorerCommands::Get().ShowReferencedObjects);
-		Section.AddMenuEntry(FRefExplorerCommands::Get().ShowReferencingObjects);
-		Section.AddMenuEntry(FRefExplorerCommands::Get().ShowReferenceTree);
+		FVector2D DesiredLocation(CurrentGraphRootOrigin);
+
+		// Content of an expanded cluster goes where the cluster was
+		if (!LastExpandedClusterPath.IsEmpty() && NewNode->GetIdentifier().PackageName.ToString().StartsWith(LastExpandedClusterPath / TEXT("")))
+		{
+			DesiredLocation = FVector2D(LastExpandedClusterLoc);
+		}
+		else if (const FRefExplorerNodeInfo* NodeInfo = RefExplorerNodeInfos.Find(NewNode->GetIdentifier()))
+		{
+			for (const FAssetIdentifier& ParentId : NodeInfo->Parents)
+			{
+				if (UEdGraphNode_RefExplorer* ParentNode = PlacedNodes.FindRef(ParentId))
+				{
+					DesiredLocation = FVector2D(ParentNode->NodePosX - FRefExplorerEditorModule_PRIVATE::LAYOUT_LAYER_SPACING, ParentNode->NodePosY);
+					break;
+				}
+			}
+		}
+
+		const FVector2D Location = SpatialIndex.FindFreeLocation(DesiredLocation, NodeSize);
+
+		NewNode->NodePosX = FMath::RoundToInt(Location.X);
+		NewNode->NodePosY = FMath::RoundToInt(Location.Y);
+
+		SpatialIndex.Add(FBox2D(Location, Location + NodeSize));
+		PlacedNodes.Add(NewNode->GetIdentifier(), NewNode);
 	}
 }
 
-FLinearColor URefExplorerSchema::GetPinTypeColor(const FEdGraphPinType& PinType) const
+FVector2D UEdGraph_RefExplorer::GetNodeSize(const UEdGraphNode_RefExplorer* Node) const
 {
-	return FRefExplorerEditorModule_PRIVATE::GetColor(FRefExplorerEditorModule_PRIVATE::ParseDependencyPinCategory(PinType.PinCategory));
+	// Widgets shrink when zoomed out, layout keeps using their full size
+	return Node->GetFullDetailSize().IsNearlyZero() ? FRefExplorerEditorModule_PRIVATE::LAYOUT_NODE_SIZE : Node->GetFullDetailSize();
 }
 
-FConnectionDrawingPolicy* URefExplorerSchema::CreateConnectionDrawingPolicy(int32 InBackLayerID, int32 InFrontLayerID, float InZoomFactor, const FSlateRect& InClippingRect, class FSlateWindowElementList& InDrawElements, class UEdGraph* InGraphObj) const
+void UEdGraph_RefExplorer::RemoveNodeOverlaps()
 {
-	return new FRefExplorerConnectionDrawingPolicy(InBackLayerID, InFrontLayerID, InZoomFactor, InClippingRect, InDrawElements);
+	const FVector2D RootLocation(CurrentGraphRootOrigin);
+
+	TArray<UEdGraphNode_RefExplorer*> RefExplorerNodes;
+	RefExplorerNodes.Reserve(Nodes.Num());
+
+	for (UEdGraphNode* Node : Nodes)
+	{
+		if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node))
+		{
+			RefExplorerNodes.Add(RefExplorerNode);
+		}
+	}
+
+	// Nodes closer to the root keep their places, outer nodes give way
+	Algo::SortBy(RefExplorerNodes, [&RootLocation](const UEdGraphNode_RefExplorer* Node) { return FVector2D::DistSquared(FVector2D(Node->NodePosX, Node->NodePosY), RootLocation); });
+
+	SpatialIndex.Reset();
+	SpatialIndexNodes.Reset(RefExplorerNodes.Num());
+
+	for (UEdGraphNode_RefExplorer* RefExplorerNode : RefExplorerNodes)
+	{
+		const FVector2D Size = GetNodeSize(RefExplorerNode) + FVector2D(FRefExplorerEditorModule_PRIVATE::LAYOUT_NODE_MARGIN);
+		FVector2D Location(RefExplorerNode->NodePosX, RefExplorerNode->NodePosY);
+
+		if (SpatialIndex.Overlaps(FBox2D(Location, Location + Size)))
+		{
+			Location = SpatialIndex.FindFreeLocation(Location, Size, FVector2D(Size.X * 0.5f, Size.Y * 0.25f));
+
+			RefExplorerNode->NodePosX = FMath::RoundToInt(Location.X);
+			RefExplorerNode->NodePosY = FMath::RoundToInt(Location.Y);
+		}
+
+		SpatialIndex.Add(FBox2D(Location, Location + Size));
+		SpatialIndexNodes.Add(RefExplorerNode);
+	}
+
+	bSpatialIndexDirty = false;
 }
 
-//--------------------------------------------------------------------
-// UEdGraphNode_RefExplorer
-//--------------------------------------------------------------------
+void UEdGraph_RefExplorer::GetNodeRects(TArray<TPair<FBox2D, FLinearColor>>& OutNodeRects) const
+{
+	if (IsLite())
+	{
+		OutNodeRects.Reserve(LiteGraph.Nodes.Num());
 
-UEdGraphNode_RefExplorer::UEdGraphNode_RefExplorer(const FObjectInitializer& ObjectInitializer) :Super(ObjectInitializer)
+		for (const FRefExplorerLiteNode& Node : LiteGraph.Nodes)
+		{
+			OutNodeRects.Emplace(FBox2D(Node.Position, Node.Position + FRefExplorerEditorModule_PRIVATE::LITE_NODE_SIZE), Node.Color);
+		}
+
+		return;
+	}
+
+	OutNodeRects.Reserve(Nodes.Num());
+
+	for (const UEdGraphNode* Node : Nodes)
+	{
+		if (const UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node))
+		{
+			const FVector2D Location(RefExplorerNode->NodePosX, RefExplorerNode->NodePosY);
+			OutNodeRects.Emplace(FBox2D(Location, Location + GetNodeSize(RefExplorerNode)), RefExplorerNode->GetNodeTitleColor());
+		}
+	}
+}
+
+void UEdGraph_RefExplorer::UpdateSpatialIndex()
 {
-	bUsesThumbnail = false;
-	bIsPackage = false;
-	bIsPrimaryAsset = false;
+	LayoutVersion++;
 
-	AssetTypeColor = FLinearColor(0.55f, 0.55f, 0.55f);
+	SpatialIndex.Reset();
+	SpatialIndexNodes.Reset(Nodes.Num());
 
-	DependencyPin = NULL;
-	ReferencerPin = NULL;
+	for (UEdGraphNode* Node : Nodes)
+	{
+		if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node))
+		{
+			const FVector2D Location(RefExplorerNode->NodePosX, RefExplorerNode->NodePosY);
+
+			SpatialIndex.Add(FBox2D(Location, Location + GetNodeSize(RefExplorerNode)));
+			SpatialIndexNodes.Add(RefExplorerNode);
+		}
+	}
+
+	UpdateAggregateRepresentatives();
+
+	bSpatialIndexDirty = false;
 }
 
-void UEdGraphNode_RefExplorer::SetupRefExplorerNode(const FIntPoint& NodeLoc, const FAssetIdentifier& NewIdentifier, const FAssetData& InAssetData)
+void UEdGraph_RefExplorer::BuildNodeAggregates()
 {
-	NodePosX = NodeLoc.X;
-	NodePosY = NodeLoc.Y;
+	NodeAggregates.Reset();
 
-	Identifier = NewIdentifier;
+	TMap<FString, int32> AggregateIndices;
 
-	FString MainAssetName = InAssetData.AssetName.ToString();
-	FString AssetTypeName = InAssetData.AssetClassPath.GetAssetName().ToString();
+	for (UEdGraphNode* Node : Nodes)
+	{
+		UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node);
+
+		if (!RefExplorerNode || !RefExplorerNode->IsPackage() || RefExplorerNode->GetIdentifier() == CurrentGraphRootIdentifier)
+		{
+			continue;
+		}
+
+		const FString Path = FRefExplorerEditorModule_PRIVATE::GetClusterPath(RefExplorerNode->GetIdentifier().PackageName.ToString(), TSet<FString>());
+
+		if (const int32* AggregateIndex = AggregateIndices.Find(Path))
+		{
+			NodeAggregates[*AggregateIndex].Members.Add(RefExplorerNode);
+		}
+		else
+		{
+			FRefExplorerNodeAggregate& NodeAggregate = NodeAggregates[AggregateIndices.Add(Path, NodeAggregates.AddDefaulted())];
+			NodeAggregate.Path = Path;
+			NodeAggregate.Members.Add(RefExplorerNode);
+		}
+	}
 
-	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
-	if (UClass* AssetClass = InAssetData.GetClass())
+	// Lone nodes are drawn as they are
+	NodeAggregates.RemoveAll([](const FRefExplorerNodeAggregate& NodeAggregate) { return NodeAggregate.Members.Num() < 2; });
+
+	for (int32 AggregateIndex = 0; AggregateIndex < NodeAggregates.Num(); AggregateIndex++)
 	{
-		TWeakPtr<IAssetTypeActions> AssetTypeActions = AssetToolsModule.Get().GetAssetTypeActionsForClass(InAssetData.GetClass());
-		if (AssetTypeActions.IsValid())
+		const TArray<UEdGraphNode_RefExplorer*>& Members = NodeAggregates[AggregateIndex].Members;
+
+		for (int32 MemberIndex = 0; MemberIndex < Members.Num(); MemberIndex++)
 		{
-			AssetTypeColor = AssetTypeActions.Pin()->GetTypeColor();
+			Members[MemberIndex]->AggregateIndex = AggregateIndex;
+			Members[MemberIndex]->AggregateMemberIndex = MemberIndex;
 		}
 	}
-	AssetBrush = FSlateIcon("EditorStyle", FName(*("ClassIcon." + AssetTypeName)));
 
-	bIsPackage = true;
+	UpdateAggregateRepresentatives();
+}
 
-	FPrimaryAssetId PrimaryAssetID = Identifier.GetPrimaryAssetId();
-	if (PrimaryAssetID.IsValid())  // Management References (PrimaryAssetIDs)
+void UEdGraph_RefExplorer::UpdateAggregateRepresentatives()
+{
+	using namespace FRefExplorerEditorModule_PRIVATE;
+
+	// Wires leave referencers on the right and enter the root on the left
+	FVector2D RootAnchor(CurrentGraphRootOrigin);
+
+	if (const UEdGraphNode_RefExplorer* RootNode = BuiltNodes.FindRef(CurrentGraphRootIdentifier))
 	{
-		static FText ManagerText = LOCTEXT("ReferenceManager", "Manager");
-		MainAssetName = PrimaryAssetID.PrimaryAssetType.ToString() + TEXT(":") + PrimaryAssetID.PrimaryAssetName.ToString();
-		AssetTypeName = ManagerText.ToString();
-		
-		bIsPackage = false;
-		bIsPrimaryAsset = true;
+		RootAnchor = FVector2D(RootNode->NodePosX, RootNode->NodePosY);
 	}
-	else if (Identifier.IsValue()) // Searchable Names (GamePlay Tags, Data Table Row Handle)
+
+	RootAnchor.Y += LAYOUT_NODE_SIZE.Y * 0.5;
+
+	for (FRefExplorerNodeAggregate& NodeAggregate : NodeAggregates)
 	{
-		MainAssetName = Identifier.ValueName.ToString();
-		AssetTypeName = Identifier.ObjectName.ToString();
-		static const FName NAME_DataTable(TEXT("DataTable"));
-		static const FText InDataTableText = LOCTEXT("InDataTable", "In DataTable");
-		if (InAssetData.AssetClassPath.GetAssetName() == NAME_DataTable)
+		FVector2D Center = FVector2D::ZeroVector;
+
+		for (const UEdGraphNode_RefExplorer* Member : NodeAggregate.Members)
 		{
-			AssetTypeName = InDataTableText.ToString() + TEXT(" ") + AssetTypeName;
+			Center += FVector2D(Member->NodePosX, Member->NodePosY);
 		}
 
-		bIsPackage = false;
+		Center /= NodeAggregate.Members.Num();
+
+		double MinDistSquared = TNumericLimits<double>::Max();
+
+		for (UEdGraphNode_RefExplorer* Member : NodeAggregate.Members)
+		{
+			const double DistSquared = FVector2D::DistSquared(Center, FVector2D(Member->NodePosX, Member->NodePosY));
+
+			if (DistSquared < MinDistSquared)
+			{
+				MinDistSquared = DistSquared;
+				NodeAggregate.Representative = Member;
+			}
+		}
+
+		NodeAggregate.BundleLocation = FMath::Lerp(Center + FVector2D(LAYOUT_NODE_SIZE.X, LAYOUT_NODE_SIZE.Y * 0.5), RootAnchor, BUNDLE_JOIN_ALPHA);
+
+		// Wires are tessellated here instead of every frame, drawing only transforms the points
+		NodeAggregate.BundlePoints.Reset((NodeAggregate.Members.Num() + 1) * BUNDLE_STRAND_POINTS);
+
+		for (const UEdGraphNode_RefExplorer* Member : NodeAggregate.Members)
+		{
+			const FVector2D MemberSize = GetNodeSize(Member);
+			AddBundleStrand(FVector2D(Member->NodePosX + MemberSize.X, Member->NodePosY + MemberSize.Y * 0.5), NodeAggregate.BundleLocation, NodeAggregate.BundlePoints);
+		}
+
+		AddBundleStrand(NodeAggregate.BundleLocation, RootAnchor, NodeAggregate.BundlePoints);
 	}
-	else if (Identifier.IsPackage() && !InAssetData.IsValid())
+}
+
+void UEdGraph_RefExplorer::AddRealizedNodeWidget(const TSharedRef<SGraphNode_RefExplorer>& NodeWidget)
+{
+	RealizedNodeWidgets.Add(NodeWidget);
+}
+
+const FRefExplorerNodeAggregate* UEdGraph_RefExplorer::GetNodeAggregate(const UEdGraphNode_RefExplorer* Node)
+{
+	if (!NodeAggregates.IsValidIndex(Node->GetAggregateIndex()))
 	{
-		const FString PackageNameStr = Identifier.PackageName.ToString();
-		if (PackageNameStr.StartsWith(TEXT("/Script")))// C++ Packages (/Script Code)
+		return nullptr;
+	}
+
+	// Representatives follow nodes moved by layout or by the user
+	if (bSpatialIndexDirty)
+	{
+		UpdateSpatialIndex();
+	}
+
+	return &NodeAggregates[Node->GetAggregateIndex()];
+}
+
+void UEdGraph_RefExplorer::FindNodesInRect(const FBox2D& Rect, TArray<UEdGraphNode_RefExplorer*>& OutNodes)
+{
+	if (bSpatialIndexDirty)
+	{
+		UpdateSpatialIndex();
+	}
+
+	TArray<int32> Indices;
+	SpatialIndex.Query(Rect, Indices);
+
+	OutNodes.Reset(Indices.Num());
+
+	for (const int32 Index : Indices)
+	{
+		if (UEdGraphNode_RefExplorer* Node = SpatialIndexNodes[Index].Get())
 		{
-			MainAssetName = PackageNameStr.RightChop(8);
-			AssetTypeName = TEXT("Script");
+			OutNodes.Add(Node);
 		}
 	}
+}
 
-	static const FName NAME_ActorLabel(TEXT("ActorLabel"));
-	InAssetData.GetTagValue(NAME_ActorLabel, MainAssetName);
+void UEdGraph_RefExplorer::CancelLayout()
+{
+	if (LayoutCancelled)
+	{
+		*LayoutCancelled = true;
+		LayoutCancelled.Reset();
+	}
+}
 
-	// append the type so it shows up on the extra line
-	NodeTitle = FText::FromString(FString::Printf(TEXT("%s\n%s"), *MainAssetName, *AssetTypeName));
+void UEdGraph_RefExplorer::UpdateLayoutCacheKey()
+{
+	TArray<FString> NodeNames;
+	NodeNames.Reserve(RefExplorerNodeInfos.Num());
 
-	if (bIsPackage)
+	for (const TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : RefExplorerNodeInfos)
 	{
-		NodeComment = Identifier.PackageName.ToString();
+		NodeNames.Add(InfoPair.Key.ToString());
 	}
 
-	if (InAssetData.IsValid() && IsPackage())
+	// Map order depends on the order links were found in, the node set does not
+	NodeNames.Sort();
+
+	LayoutCacheNodeSetHash = 0;
+
+	for (const FString& NodeName : NodeNames)
 	{
-		bUsesThumbnail = true;
-		CachedAssetData = InAssetData;
+		LayoutCacheNodeSetHash = HashCombine(LayoutCacheNodeSetHash, FCrc::StrCrc32(*NodeName));
 	}
-	else
-	{
-		bUsesThumbnail = false;
-		CachedAssetData = FAssetData();
 
-		const FString PackageNameStr = Identifier.PackageName.ToString();
-		if (FPackageName::IsValidLongPackageName(PackageNameStr, true))
+	LayoutCacheRootName = CurrentGraphRootIdentifier.ToString();
+
+	const FString CacheName = FString::Printf(TEXT("%08X_%d.layout"), FCrc::StrCrc32(*LayoutCacheRootName), static_cast<int32>(LayoutMode));
+	LayoutCacheFilename = FPaths::ProjectSavedDir() / TEXT("RefExplorer") / TEXT("Layouts") / CacheName;
+
+	bLayoutCacheDirty = false;
+}
+
+void UEdGraph_RefExplorer::LoadLayoutCache()
+{
+	TWeakObjectPtr<UEdGraph_RefExplorer> WeakGraph(this);
+	const uint32 Serial = RebuildSerial;
+
+	Async(EAsyncExecution::ThreadPool, [WeakGraph, Serial, Filename = LayoutCacheFilename, ExpectedRootName = LayoutCacheRootName, ExpectedNodeSetHash = LayoutCacheNodeSetHash]()
 		{
-			if (PackageNameStr.StartsWith(TEXT("/Script")))
+			TArray<uint8> Data;
+			TMap<FString, FIntPoint> Positions;
+
 			{
-				// Used Only in the UI for the Thumbnail
-				CachedAssetData.AssetClassPath = FTopLevelAssetPath(TEXT("/EdGraphNode_Reference"), TEXT("Code"));
+				FScopeLock Lock(&FRefExplorerEditorModule_PRIVATE::LayoutCacheFileLock);
+
+				if (!Filename.IsEmpty())
+				{
+					FFileHelper::LoadFileToArray(Data, *Filename, FILEREAD_Silent);
+				}
 			}
-			else
+
+			if (!Data.IsEmpty())
 			{
-				const FString PotentiallyMapFilename = FPackageName::LongPackageNameToFilename(PackageNameStr, FPackageName::GetMapPackageExtension());
-				const bool bIsMapPackage = FPlatformFileManager::Get().GetPlatformFile().FileExists(*PotentiallyMapFilename);
-				if (bIsMapPackage)
+				FMemoryReader Reader(Data);
+
+				int32 Version = 0;
+				FString RootName;
+				uint32 NodeSetHash = 0;
+
+				Reader << Version << RootName << NodeSetHash;
+
+				// Different file names may collide, so the root is stored as well
+				if (!Reader.IsError() && Version == FRefExplorerEditorModule_PRIVATE::LAYOUT_CACHE_VERSION && RootName == ExpectedRootName && NodeSetHash == ExpectedNodeSetHash)
 				{
-					// Used Only in the UI for the Thumbnail
-					CachedAssetData.AssetClassPath = TEXT("/Script/Engine.World");
+					Reader << Positions;
+				}
+
+				if (Reader.IsError())
+				{
+					Positions.Reset();
 				}
 			}
-		}
-	}
 
-	AllocateDefaultPins();
+			AsyncTask(ENamedThreads::GameThread, [WeakGraph, Serial, Positions = MoveTemp(Positions)]()
+				{
+					UEdGraph_RefExplorer* Graph = WeakGraph.Get();
+
+					if (Graph && Graph->RebuildSerial == Serial)
+					{
+						Graph->OnLayoutCacheLoaded(Positions);
+					}
+				});
+		});
 }
 
-void UEdGraphNode_RefExplorer::AddReferencer(UEdGraphNode_RefExplorer* ReferencerNode)
+void UEdGraph_RefExplorer::OnLayoutCacheLoaded(const TMap<FString, FIntPoint>& CachedPositions)
 {
-	UEdGraphPin* ReferencerDependencyPin = ReferencerNode->GetDependencyPin();
+	TMap<FAssetIdentifier, FIntPoint> Positions;
+	Positions.Reserve(CachedPositions.Num());
 
-	if (ensure(ReferencerDependencyPin))
+	for (const TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : RefExplorerNodeInfos)
 	{
-		ReferencerDependencyPin->bHidden = false;
-		ReferencerPin->bHidden = false;
-		ReferencerPin->MakeLinkTo(ReferencerDependencyPin);
-	}
-}
+		const FIntPoint* Position = CachedPositions.Find(InfoPair.Key.ToString());
 
-UEdGraph_RefExplorer* UEdGraphNode_RefExplorer::GetRefExplorerGraph() const { return Cast<UEdGraph_RefExplorer>(GetGraph()); }
+		if (!Position)
+		{
+			Positions.Reset();
+			break;
+		}
 
-FLinearColor UEdGraphNode_RefExplorer::GetNodeTitleColor() const
-{
-	if (bIsPrimaryAsset)
+		Positions.Add(InfoPair.Key, CurrentGraphRootOrigin + *Position);
+	}
+
+	if (!Positions.IsEmpty())
 	{
-		return FLinearColor(0.2f, 0.8f, 0.2f);
+		// Same nodes as last time, so every node has its position and no layout is needed
+		PlaceNodesIncrementally(Positions);
+		UpdateSpatialIndex();
+		bLayoutApplied = true;
+
+		ZoomExplorerToFit();
 	}
-	else if (bIsPackage)
+	else if (LayoutMode != FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode::Radial)
 	{
-		return AssetTypeColor;
+		LayoutGraph();
 	}
 	else
 	{
-		return FLinearColor(0.0f, 0.55f, 0.62f);
+		RemoveNodeOverlaps();
+		SaveLayoutCache();
+		bLayoutApplied = true;
 	}
 }
 
-FText UEdGraphNode_RefExplorer::GetTooltipText() const { return FText::FromString(Identifier.ToString()); }
-
-void UEdGraphNode_RefExplorer::AllocateDefaultPins()
+void UEdGraph_RefExplorer::SaveLayoutCache()
 {
-	FName PassiveName = FRefExplorerEditorModule_PRIVATE::GetName(FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkEndPassive);
+	bLayoutCacheDirty = false;
 
-	ReferencerPin = CreatePin(EEdGraphPinDirection::EGPD_Input, NAME_None, NAME_None);
-	ReferencerPin->bHidden = true;
-	ReferencerPin->PinType.PinCategory = PassiveName;
+	if (LayoutCacheFilename.IsEmpty())
+	{
+		return;
+	}
 
-	DependencyPin = CreatePin(EEdGraphPinDirection::EGPD_Output, NAME_None, NAME_None);
-	DependencyPin->bHidden = true;
-	DependencyPin->PinType.PinCategory = PassiveName;
-}
+	// Relative to the root, the same layout may be shown around a different origin
+	TMap<FString, FIntPoint> Positions;
+	Positions.Reserve(Nodes.Num());
 
-//--------------------------------------------------------------------
-// UEdGraph_RefExplorer
-//--------------------------------------------------------------------
+	for (UEdGraphNode* Node : Nodes)
+	{
+		if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node))
+		{
+			Positions.Add(RefExplorerNode->GetIdentifier().ToString(), FIntPoint(RefExplorerNode->NodePosX, RefExplorerNode->NodePosY) - CurrentGraphRootOrigin);
+		}
+	}
 
-UEdGraph_RefExplorer::UEdGraph_RefExplorer(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer)
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+
+	int32 Version = FRefExplorerEditorModule_PRIVATE::LAYOUT_CACHE_VERSION;
+	FString RootName = LayoutCacheRootName;
+	uint32 NodeSetHash = LayoutCacheNodeSetHash;
+
+	Writer << Version << RootName << NodeSetHash << Positions;
+
+	// Nothing waits for the file, it is only read again by a later rebuild
+	Async(EAsyncExecution::ThreadPool, [Filename = LayoutCacheFilename, Data = MoveTemp(Data)]()
+		{
+			FScopeLock Lock(&FRefExplorerEditorModule_PRIVATE::LayoutCacheFileLock);
+			FFileHelper::SaveArrayToFile(Data, *Filename);
+		});
+}
+
+void UEdGraph_RefExplorer::FlushLayoutCache()
 {
-	if (!IsTemplate())
+	if (bLayoutCacheDirty)
 	{
-		AssetThumbnailPool = MakeShareable(new FAssetThumbnailPool(1024));
+		SaveLayoutCache();
 	}
 }
 
-void UEdGraph_RefExplorer::BeginDestroy()
+void UEdGraph_RefExplorer::ApplyLayout(const TArray<FAssetIdentifier>& LayoutIdentifiers, const TArray<FVector2D>& Positions, bool bZoomToFit, bool bRemoveOverlaps)
 {
-	AssetThumbnailPool.Reset();
+	TMap<FAssetIdentifier, int32> LayoutIndices;
+	LayoutIndices.Reserve(LayoutIdentifiers.Num());
 
-	Super::BeginDestroy();
+	for (int32 LayoutIndex = 0; LayoutIndex < LayoutIdentifiers.Num(); LayoutIndex++)
+	{
+		LayoutIndices.Add(LayoutIdentifiers[LayoutIndex], LayoutIndex);
+	}
+
+	for (UEdGraphNode* Node : Nodes)
+	{
+		if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node))
+		{
+			if (const int32* LayoutIndex = LayoutIndices.Find(RefExplorerNode->GetIdentifier()))
+			{
+				RefExplorerNode->NodePosX = CurrentGraphRootOrigin.X + FMath::RoundToInt(Positions[*LayoutIndex].X);
+				RefExplorerNode->NodePosY = CurrentGraphRootOrigin.Y + FMath::RoundToInt(Positions[*LayoutIndex].Y);
+			}
+		}
+	}
+
+	if (bRemoveOverlaps)
+	{
+		RemoveNodeOverlaps();
+		SaveLayoutCache();
+		bLayoutApplied = true;
+	}
+	else
+	{
+		MarkSpatialIndexDirty();
+	}
+
+	if (bZoomToFit)
+	{
+		ZoomExplorerToFit();
+	}
 }
 
-void UEdGraph_RefExplorer::SetGraphRoot(const FAssetIdentifier& GraphRootIdentifier, const FIntPoint& GraphRootOrigin)
+void UEdGraph_RefExplorer::ZoomExplorerToFit() const
 {
-	CurrentGraphRootIdentifier = GraphRootIdentifier;
-	CurrentGraphRootOrigin = GraphRootOrigin;
-	UAssetManager::Get().UpdateManagementDatabase();
+	// Layout usually lands after the explorer zoomed to the old positions
+	if (TSharedPtr<SRefExplorer> RefExplorerPtr = RefExplorer.Pin())
+	{
+		if (TSharedPtr<SGraphEditor> GraphEditor = RefExplorerPtr->GetGraphEditor())
+		{
+			GraphEditor->ZoomToFit(false);
+		}
+	}
 }
 
-UEdGraphNode_RefExplorer* UEdGraph_RefExplorer::RebuildGraph()
+void UEdGraph_RefExplorer::SetReadPropertiesFromDisk(bool bInReadPropertiesFromDisk)
 {
-	RemoveAllNodes();
+	if (bReadPropertiesFromDisk != bInReadPropertiesFromDisk)
+	{
+		bReadPropertiesFromDisk = bInReadPropertiesFromDisk;
+		RefPropInfos.Reset();
+		SkippedWhileCompiling.Reset();
+	}
+}
 
-	RefExplorerNodeInfos.Reset();
-	RefExplorerNodeInfos.FindOrAdd(CurrentGraphRootIdentifier, FRefExplorerNodeInfo(CurrentGraphRootIdentifier));
+const TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo>& UEdGraph_RefExplorer::GetRefPropInfos(const UEdGraphNode_RefExplorer* ReferencerNode)
+{
+	static const TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo> EmptyRefPropInfos;
 
-	TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory> ReferenceLinks;
-	GetSortedLinks(CurrentGraphRootIdentifier, ReferenceLinks);
+	if (const TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo>* CachedRefPropInfos = RefPropInfos.Find(ReferencerNode->GetIdentifier()))
+	{
+		return *CachedRefPropInfos;
+	}
 
-	RefExplorerNodeInfos[CurrentGraphRootIdentifier].Children.Reserve(ReferenceLinks.Num());
+	// Properties read from disk are added by the async job once it is done
+	if (bReadPropertiesFromDisk || !ReferencerNode->IsPackage())
+	{
+		return EmptyRefPropInfos;
+	}
 
-	for (const TPair<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& Pair : ReferenceLinks)
+	// Classes are being regenerated, nothing is cached so the node is refreshed once compilation is done
+	if (CompilingPackages.Contains(CurrentGraphRootIdentifier.PackageName) || CompilingPackages.Contains(ReferencerNode->GetIdentifier().PackageName))
 	{
-		const FAssetIdentifier ChildId = Pair.Key;
+		SkippedWhileCompiling.Add(ReferencerNode->GetIdentifier());
+		return EmptyRefPropInfos;
+	}
 
-		if (!RefExplorerNodeInfos.Contains(ChildId))
-		{
-			FRefExplorerNodeInfo& NewNodeInfo = RefExplorerNodeInfos.FindOrAdd(ChildId, FRefExplorerNodeInfo(ChildId));
-			RefExplorerNodeInfos[ChildId].Parents.FindOrAdd(CurrentGraphRootIdentifier);
-			RefExplorerNodeInfos[CurrentGraphRootIdentifier].Children.Emplace(Pair);
-		}
-		else if (!RefExplorerNodeInfos[ChildId].Parents.Contains(CurrentGraphRootIdentifier))
+	TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo> NewRefPropInfos;
+
+	if (UObject* RootAsset = GetGraphRootNodeInfo().AssetData.GetAsset())
+	{
+		if (UObject* RefAsset = ReferencerNode->GetAssetData().GetAsset())
 		{
-			RefExplorerNodeInfos[ChildId].Parents.FindOrAdd(CurrentGraphRootIdentifier);
-			RefExplorerNodeInfos[CurrentGraphRootIdentifier].Children.Emplace(Pair);
+			if (RootAsset != RefAsset)
+			{
+				FRefExplorerEditorModule_PRIVATE::FRefPropCollector(RootAsset, NewRefPropInfos).Collect(RefAsset);
+			}
 		}
 	}
 
-	TSet<FName> AllPackageNames;
+	return RefPropInfos.Add(ReferencerNode->GetIdentifier(), MoveTemp(NewRefPropInfos));
+}
 
-	for (TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : RefExplorerNodeInfos)
+void UEdGraph_RefExplorer::OnBlueprintPreCompile(UBlueprint* Blueprint)
+{
+	if (Blueprint)
 	{
-		if (!InfoPair.Key.IsValue() && !InfoPair.Key.PackageName.IsNone())
-		{
-			AllPackageNames.Add(InfoPair.Key.PackageName);
-		}
+		CompilingPackages.Add(Blueprint->GetPackage()->GetFName());
 	}
+}
 
-	TMap<FName, FAssetData> PackagesToAssetDataMap;
-	UE::AssetRegistry::GetAssetForPackages(AllPackageNames.Array(), PackagesToAssetDataMap);
+void UEdGraph_RefExplorer::OnBlueprintCompiled()
+{
+	TSet<FName> CompiledPackages = MoveTemp(CompilingPackages);
+	CompilingPackages.Reset();
 
-	TSet<FTopLevelAssetPath> AllClasses;
-	for (TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : RefExplorerNodeInfos)
+	InvalidateRefPropInfos(CompiledPackages);
+}
+
+void UEdGraph_RefExplorer::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	TSet<FName> ReinstancedPackages;
+
+	for (const TPair<UObject*, UObject*>& Pair : ReplacementMap)
 	{
-		InfoPair.Value.AssetData = PackagesToAssetDataMap.FindRef(InfoPair.Key.PackageName);
-		if (InfoPair.Value.AssetData.IsValid())
+		if (Pair.Value)
 		{
-			AllClasses.Add(InfoPair.Value.AssetData.AssetClassPath);
+			ReinstancedPackages.Add(Pair.Value->GetPackage()->GetFName());
 		}
 	}
 
-	UEdGraphNode_RefExplorer* RootNode = nullptr;
+	InvalidateRefPropInfos(ReinstancedPackages);
+}
 
-	if (!RefExplorerNodeInfos.IsEmpty())
+void UEdGraph_RefExplorer::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	if (Package)
 	{
-		const FRefExplorerNodeInfo& NodeInfo = RefExplorerNodeInfos[CurrentGraphRootIdentifier];
-		RootNode = Cast<UEdGraphNode_RefExplorer>(CreateNode(UEdGraphNode_RefExplorer::StaticClass(), false));
-		RootNode->SetupRefExplorerNode(CurrentGraphRootOrigin, CurrentGraphRootIdentifier, NodeInfo.AssetData);
+		InvalidateRefPropInfos({ Package->GetFName() }, true);
+	}
+}
 
-		// References
-		RecursivelyCreateNodes(CurrentGraphRootIdentifier, CurrentGraphRootOrigin, CurrentGraphRootIdentifier, RootNode, RefExplorerNodeInfos, /*bIsRoot*/ true);
+void UEdGraph_RefExplorer::InvalidateRefPropInfos(const TSet<FName>& PackageNames, bool bFilesChanged)
+{
+	// Properties read from disk reflect saved files, compiling does not change them
+	if ((bReadPropertiesFromDisk && !bFilesChanged) || PackageNames.IsEmpty() || (RefPropInfos.IsEmpty() && SkippedWhileCompiling.IsEmpty()))
+	{
+		return;
 	}
 
-	NotifyGraphChanged();
+	const bool bRootChanged = PackageNames.Contains(CurrentGraphRootIdentifier.PackageName);
 
-	return RootNode;
-}
+	UEdGraphNode_RefExplorer* RootNode = nullptr;
+	TArray<UEdGraphNode_RefExplorer*> NodesToRefresh;
 
-void UEdGraph_RefExplorer::GetSortedLinks(const FAssetIdentifier& GraphRootIdentifier, TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& OutLinks) const
-{
-	using namespace UE::AssetRegistry;
-	auto CategoryOrder = [](EDependencyCategory InCategory)
+	for (UEdGraphNode* Node : Nodes)
+	{
+		if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node))
 		{
-			switch (InCategory)
-			{
-			case EDependencyCategory::Package:
-			{
-				return 0;
-			}
-			case EDependencyCategory::Manage:
-			{
-				return 1;
-			}
-			case EDependencyCategory::SearchableName:
+			if (RefExplorerNode->GetIdentifier() == CurrentGraphRootIdentifier)
 			{
-				return 2;
+				RootNode = RefExplorerNode;
 			}
-			default:
+			else if (bRootChanged || PackageNames.Contains(RefExplorerNode->GetIdentifier().PackageName))
 			{
-				check(false);
-				return 3;
-			}
+				// Nodes asked for while compiling have nothing cached but still show no properties
+				const bool bWasCached = RefPropInfos.Remove(RefExplorerNode->GetIdentifier()) > 0;
+				const bool bWasSkipped = SkippedWhileCompiling.Remove(RefExplorerNode->GetIdentifier()) > 0;
+
+				if (bWasCached || bWasSkipped)
+				{
+					NodesToRefresh.Add(RefExplorerNode);
+				}
 			}
-		};
-	auto IsHard = [](EDependencyProperty Properties)
-		{
-			return static_cast<bool>(((Properties & EDependencyProperty::Hard) != EDependencyProperty::None) | ((Properties & EDependencyProperty::Direct) != EDependencyProperty::None));
-		};
+		}
+	}
 
-	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
-	TArray<FAssetDependency> LinksToAsset;
+	if (NodesToRefresh.IsEmpty())
+	{
+		return;
+	}
 
-	LinksToAsset.Reset();
+	// Only referencers without cached properties are read again
+	if (bReadPropertiesFromDisk)
+	{
+		GatherRefPropInfosFromDisk();
+	}
 
-	using namespace UE::AssetRegistry;
-	EDependencyCategory Categories = EDependencyCategory::Package | EDependencyCategory::Manage;
-	EDependencyQuery Flags = EDependencyQuery::NoRequirements;
+	if (bShowPropertyPins && RootNode)
+	{
+		for (UEdGraphNode_RefExplorer* NodeToRefresh : NodesToRefresh)
+		{
+			NodeToRefresh->SetupPropertyPins(TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo>(), RootNode);
+		}
 
-	AssetRegistry.GetReferencers(GraphRootIdentifier, LinksToAsset, Categories, Flags);
+		CreatePropertyPins();
+		NodesToRefresh.Add(RootNode);
+	}
 
-	// Sort the links from most important kind of link to least important kind of link, so that if we can't display them all in an ExceedsMaxSearchBreadth test, we
-	// show the most important links.
-	Algo::Sort(LinksToAsset, [&CategoryOrder, &IsHard](const FAssetDependency& A, const FAssetDependency& B)
+	// Widgets rescan their nodes while being rebuilt
+	if (TSharedPtr<SRefExplorer> RefExplorerPtr = RefExplorer.Pin())
+	{
+		if (TSharedPtr<SGraphEditor> GraphEditor = RefExplorerPtr->GetGraphEditor())
 		{
-			if (A.Category != B.Category)
-			{
-				return CategoryOrder(A.Category) < CategoryOrder(B.Category);
-			}
-			if (A.Properties != B.Properties)
+			for (UEdGraphNode_RefExplorer* NodeToRefresh : NodesToRefresh)
 			{
-				bool bAIsHard = IsHard(A.Properties);
-				bool bBIsHard = IsHard(B.Properties);
-				if (bAIsHard != bBIsHard)
-				{
-					return bAIsHard;
-				}
+				GraphEditor->RefreshNode(*NodeToRefresh);
 			}
-			return A.AssetId.PackageName.LexicalLess(B.AssetId.PackageName);
-		});
-	for (const FAssetDependency& LinkToAsset : LinksToAsset)
-	{
-		FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory& Category = OutLinks.FindOrAdd(LinkToAsset.AssetId, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkEndActive);
-		bool bIsHard = IsHard(LinkToAsset.Properties);
-		bool bIsUsedInGame = (LinkToAsset.Category != EDependencyCategory::Package) || ((LinkToAsset.Properties & EDependencyProperty::Game) != EDependencyProperty::None);
-		Category |= FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkEndActive;
-		Category |= bIsHard ? FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkTypeHard : FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkTypeNone;
-		Category |= bIsUsedInGame ? FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkTypeUsedInGame : FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory::LinkTypeNone;
+		}
 	}
+}
 
-	// Check filters and Filter for our registry source
-	
-	TArray<FAssetIdentifier> ReferenceIds;
-	OutLinks.GenerateKeyArray(ReferenceIds);
-	
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+void UEdGraph_RefExplorer::GatherRefPropInfosFromDisk()
+{
+	const FName RootPackageName = CurrentGraphRootIdentifier.PackageName;
 
-	for (int32 Index = 0; Index < ReferenceIds.Num(); Index++)
+	if (!CurrentGraphRootIdentifier.IsPackage() || RootPackageName.IsNone())
 	{
-		FName PackageName = ReferenceIds[Index].PackageName;
+		return;
+	}
 
-		if (PackageName != NAME_None)
+	TArray<FAssetIdentifier> ReferencerIdentifiers;
+
+	for (const TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : RefExplorerNodeInfos)
+	{
+		if (InfoPair.Key.IsPackage() && InfoPair.Key.PackageName != RootPackageName && InfoPair.Value.AssetData.IsValid() && !RefPropInfos.Contains(InfoPair.Key))
 		{
-			TOptional<FAssetPackageData> assetPackageData = AssetRegistryModule.Get().GetAssetPackageDataCopy(PackageName);
+			ReferencerIdentifiers.Add(InfoPair.Key);
+		}
+	}
 
-			if (!assetPackageData.GetPtrOrNull() || assetPackageData.GetPtrOrNull()->DiskSize < 0)
-			{
-				// Remove bad package
-				ReferenceIds.RemoveAt(Index);
+	if (ReferencerIdentifiers.IsEmpty())
+	{
+		return;
+	}
 
-				// If this is a redirector replace with references
-				TArray<FAssetData> Assets;
-				AssetRegistryModule.Get().GetAssetsByPackageName(PackageName, Assets, true);
+	TWeakObjectPtr<UEdGraph_RefExplorer> WeakGraph(this);
+	const uint32 Serial = RebuildSerial;
 
-				for (const FAssetData& Asset : Assets)
+	// Struct serialization is only known from loaded struct types, which can't be looked up off the game thread
+	TSet<FName> NativeStructNames = FRefExplorerEditorModule_PRIVATE::FPackagePropertyReader::GetNativeStructNames();
+
+	Async(EAsyncExecution::ThreadPool, [WeakGraph, Serial, RootPackageName, ReferencerIdentifiers = MoveTemp(ReferencerIdentifiers), NativeStructNames = MoveTemp(NativeStructNames)]()
+		{
+			TArray<TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo>> Results;
+			Results.SetNum(ReferencerIdentifiers.Num());
+
+			ParallelFor(ReferencerIdentifiers.Num(), [&](int32 Index)
 				{
-					if (Asset.IsRedirector())
+					FRefExplorerEditorModule_PRIVATE::FPackagePropertyReader(RootPackageName, NativeStructNames, Results[Index]).Read(ReferencerIdentifiers[Index].PackageName);
+				});
+
+			AsyncTask(ENamedThreads::GameThread, [WeakGraph, Serial, ReferencerIdentifiers, Results = MoveTemp(Results)]() mutable
+				{
+					UEdGraph_RefExplorer* Graph = WeakGraph.Get();
+
+					if (Graph && Graph->RebuildSerial == Serial)
 					{
-						TArray<FAssetIdentifier> FoundReferences;
+						for (int32 Index = 0; Index < ReferencerIdentifiers.Num(); Index++)
+						{
+							Graph->RefPropInfos.Add(ReferencerIdentifiers[Index], MoveTemp(Results[Index]));
+						}
 
-						AssetRegistryModule.Get().GetReferencers(PackageName, FoundReferences, Categories, Flags);
+						if (Graph->bShowPropertyPins)
+						{
+							Graph->CreatePropertyPins();
+						}
 
-						ReferenceIds.Insert(FoundReferences, Index);
-						break;
+						Graph->NotifyGraphChanged();
 					}
-				}
+				});
+		});
+}
 
-				// Need to redo this index, it was either removed or replaced
-				Index--;
-			}
-		}
-	}
+void UEdGraph_RefExplorer::CreatePropertyPins()
+{
+	UEdGraphNode_RefExplorer* RootNode = nullptr;
+	TArray<UEdGraphNode_RefExplorer*> ReferencerNodes;
 
-	for (TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>::TIterator It(OutLinks); It; ++It)
+	for (UEdGraphNode* Node : Nodes)
 	{
-		////// Here was scripts filtering like InAssetIdentifier.PackageName.ToString().StartsWith(TEXT("/Script"))
-		//////if (!IsPackageIdentifierPassingFilter(It.Key()))
-		//////{
-		//////	It.RemoveCurrent();
-		//////}
-		//////else if (!ReferenceIds.Contains(It.Key()))
-		if (!ReferenceIds.Contains(It.Key()))
+		if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node))
 		{
-			It.RemoveCurrent();
+			if (RefExplorerNode->GetIdentifier() == CurrentGraphRootIdentifier)
+			{
+				RootNode = RefExplorerNode;
+			}
+			else if (RefExplorerNode->IsPackage() && !RefExplorerNode->HasPropertyPins())
+			{
+				ReferencerNodes.Add(RefExplorerNode);
+			}
 		}
 	}
-}
 
-void UEdGraph_RefExplorer::GatherAssetData(TMap<FAssetIdentifier, FRefExplorerNodeInfo>& InNodeInfos)
-{
-	// Grab the list of packages
-	TSet<FName> PackageNames;
-	for (TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : InNodeInfos)
+	if (!RootNode)
 	{
-		FAssetIdentifier& AssetId = InfoPair.Key;
-		if (!AssetId.IsValue() && !AssetId.PackageName.IsNone())
-		{
-			PackageNames.Add(AssetId.PackageName);
-		}
+		return;
 	}
 
-	// Retrieve the AssetData from the Registry
-	TMap<FName, FAssetData> PackagesToAssetDataMap;
-	UE::AssetRegistry::GetAssetForPackages(PackageNames.Array(), PackagesToAssetDataMap);
+	const FRefExplorerNodeInfo& RootNodeInfo = GetGraphRootNodeInfo();
 
+	// Queued referencers are gathered again below, as long as their pins are still missing
+	PropertyPinQueue.Reset();
+	PropertyPinQueueHead = 0;
 
-	// Populate the AssetData back into the NodeInfos
-	for (TPair<FAssetIdentifier, FRefExplorerNodeInfo>& InfoPair : InNodeInfos)
+	for (UEdGraphNode_RefExplorer* ReferencerNode : ReferencerNodes)
 	{
-		InfoPair.Value.AssetData = PackagesToAssetDataMap.FindRef(InfoPair.Key.PackageName);
+		if (RootNodeInfo.Children.ContainsByPredicate([&](const TPair<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& Pair) { return Pair.Key == ReferencerNode->GetIdentifier(); }))
+		{
+			// Loading referencers to collect their properties is spread over several frames
+			if (bReadPropertiesFromDisk || RefPropInfos.Contains(ReferencerNode->GetIdentifier()))
+			{
+				ReferencerNode->SetupPropertyPins(GetRefPropInfos(ReferencerNode), RootNode);
+			}
+			else
+			{
+				PropertyPinQueue.Add(ReferencerNode);
+			}
+		}
 	}
-}
 
-UEdGraphNode_RefExplorer* UEdGraph_RefExplorer::RecursivelyCreateNodes(const FAssetIdentifier& InAssetId, const FIntPoint& InNodeLoc, const FAssetIdentifier& InParentId, UEdGraphNode_RefExplorer* InParentNode, TMap<FAssetIdentifier, FRefExplorerNodeInfo>& InNodeInfos, bool bIsRoot)
-{
-	check(InNodeInfos.Contains(InAssetId));
-
-	const FRefExplorerNodeInfo& NodeInfo = InNodeInfos[InAssetId];
-
-	UEdGraphNode_RefExplorer* NewNode = nullptr;
-	
-	if (bIsRoot)
+	if (PropertyPinQueue.IsEmpty())
 	{
-		NewNode = InParentNode;
+		StopPropertyPins();
 	}
-	else
+	else if (!PropertyPinTickerHandle.IsValid())
 	{
-		NewNode = Cast<UEdGraphNode_RefExplorer>(CreateNode(UEdGraphNode_RefExplorer::StaticClass(), false));
-		NewNode->SetupRefExplorerNode(InNodeLoc, { InAssetId }, NodeInfo.AssetData);
+		PropertyPinTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UEdGraph_RefExplorer::TickPropertyPins));
 	}
+}
 
-	FIntPoint ChildLoc = InNodeLoc;
-
-	const int32 WidthStep = 256;
-	const int32 HeightStep = 400;
-	
-	if (InNodeInfos[InAssetId].Children.Num() > 0)
+bool UEdGraph_RefExplorer::TickPropertyPins(float DeltaTime)
+{
+	UEdGraphNode_RefExplorer* RootNode = BuiltNodes.FindRef(CurrentGraphRootIdentifier);
+	if (!RootNode)
 	{
-		const float DeltaAngle = UE_PI / InNodeInfos[InAssetId].Children.Num();
-		const float LastAngle = DeltaAngle * (InNodeInfos[InAssetId].Children.Num() == 1 ? 0 : (InNodeInfos[InAssetId].Children.Num() - 1));		
-		const float Radius = HeightStep / FMath::Max(FMath::Abs(1 - FMath::Cos(DeltaAngle)), FMath::Abs(FMath::Sin(DeltaAngle)));
+		StopPropertyPins();
+		return false;
+	}
 
-		for (int32 ChildIdx = 0; ChildIdx < InNodeInfos[InAssetId].Children.Num(); ChildIdx++)
-		{
-			const TPair<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& Pair = InNodeInfos[InAssetId].Children[ChildIdx];
+	TArray<UEdGraphNode_RefExplorer*> NodesToRefresh;
 
-			FAssetIdentifier ChildId = Pair.Key;
+	const double EndTime = FPlatformTime::Seconds() + FRefExplorerEditorModule_PRIVATE::PROPERTY_PINS_FRAME_BUDGET;
 
-			const float AccumAngle = ChildIdx * DeltaAngle;
+	do
+	{
+		if (UEdGraphNode_RefExplorer* ReferencerNode = PropertyPinQueue[PropertyPinQueueHead++].Get())
+		{
+			if (!ReferencerNode->HasPropertyPins())
+			{
+				ReferencerNode->SetupPropertyPins(GetRefPropInfos(ReferencerNode), RootNode);
+				NodesToRefresh.Add(ReferencerNode);
+			}
+		}
+	} while (PropertyPinQueueHead < PropertyPinQueue.Num() && FPlatformTime::Seconds() < EndTime);
 
-			ChildLoc.X = InNodeLoc.X - (FMath::Min(ChildIdx, InNodeInfos[InAssetId].Children.Num() - ChildIdx - 1) + 1) * WidthStep;
-			ChildLoc.Y = InNodeLoc.Y - Radius * FMath::Sin(AccumAngle + (UE_PI - LastAngle / 2));
+	const bool bDone = PropertyPinQueueHead >= PropertyPinQueue.Num();
+	if (bDone)
+	{
+		PropertyPinTickerHandle.Reset();
+		PropertyPinQueue.Reset();
+		PropertyPinQueueHead = 0;
+	}
 
-			UEdGraphNode_RefExplorer* ChildNode = RecursivelyCreateNodes(ChildId, ChildLoc, InAssetId, NewNode, InNodeInfos);
+	if (!NodesToRefresh.IsEmpty())
+	{
+		NodesToRefresh.Add(RootNode);
 
-			ChildNode->GetDependencyPin()->PinType.PinCategory = FRefExplorerEditorModule_PRIVATE::GetName(Pair.Value);
-			NewNode->AddReferencer(ChildNode);
+		if (TSharedPtr<SRefExplorer> RefExplorerPtr = RefExplorer.Pin())
+		{
+			if (TSharedPtr<SGraphEditor> GraphEditor = RefExplorerPtr->GetGraphEditor())
+			{
+				for (UEdGraphNode_RefExplorer* NodeToRefresh : NodesToRefresh)
+				{
+					GraphEditor->RefreshNode(*NodeToRefresh);
+				}
+			}
 		}
 	}
 
-	return NewNode;
+	return !bDone;
 }
 
-const TSharedPtr<FAssetThumbnailPool>& UEdGraph_RefExplorer::GetAssetThumbnailPool() const
+void UEdGraph_RefExplorer::StopPropertyPins()
 {
-	return AssetThumbnailPool;
+	if (PropertyPinTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PropertyPinTickerHandle);
+		PropertyPinTickerHandle.Reset();
+	}
+
+	PropertyPinQueue.Reset();
+	PropertyPinQueueHead = 0;
 }
 
 void UEdGraph_RefExplorer::RemoveAllNodes()
@@ -1114,6 +4727,22 @@ void UEdGraph_RefExplorer::RemoveAllNodes()
 	{
 		RemoveNode(NodesToRemove[NodeIndex]);
 	}
+
+	StopPopulating();
+	StopPropertyPins();
+
+	NodeBuildQueue.Reset();
+	NodeBuildQueueHead = 0;
+	LastPopulateSeconds = 0.0;
+	BuiltNodes.Reset();
+	NodeAggregates.Reset();
+	PendingMapPackages.Reset();
+	RealizedNodeWidgets.Reset();
+	LiteGraph.Reset();
+	bLayoutApplied = false;
+
+	// The panel lets go of the old widgets before it asks for new ones
+	NodeWidgetPoolCursor = 0;
 }
 
 //------------------------------------------------------
@@ -1133,42 +4762,305 @@ public:
 	// SGraphNode implementation
 	virtual void UpdateGraphNode() override;
 	virtual bool IsNodeEditable() const override { return false; }
+	virtual void MoveTo(const FVector2D& NewPosition, FNodeSet& NodeFilter, bool bMarkDirty = true) override;
 	// End SGraphNode implementation
 
+	// SWidget implementation
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	// End SWidget implementation
+
+	/** Goes back to a placeholder with just the pins, until the node is painted again */
+	void ReleaseContent();
+
+	/** Shows another node, for reusing the widget once its panel let go of it */
+	void Rebind(UEdGraphNode_RefExplorer* InNode);
+
+	FORCEINLINE const TSharedPtr<class FAssetThumbnail>& GetAssetThumbnail() const { return AssetThumbnail; }
+
 private:
+	FRefExplorerEditorModule_PRIVATE::ERefExplorerDetailLevel GetDetailLevel() const;
+
+	/** Gets the aggregate the node draws the summary of, nullptr if it is drawn as itself */
+	const FRefExplorerNodeAggregate* GetSummarizedAggregate() const;
+
+	/** Aggregated nodes are hidden when zoomed out, except for the one drawing the summary */
+	EVisibility GetNodeVisibility() const;
+	FText GetSummaryText() const;
+
+	/** Builds a colored box when zoomed out and the title only at medium zoom, with just the pins needed for wires */
+	void UpdateLowDetailGraphNode();
+
+	/** Gets the thumbnail of the node rendered at the given resolution, drawn at that size. Null widget if the node has none */
+	TSharedRef<SWidget> MakeThumbnailWidget(uint32 Resolution);
+
 	TSharedPtr<class FAssetThumbnail> AssetThumbnail;
+
+	/** Detail level the current widgets were built for, they are rebuilt when the zoom crosses to another level */
+	FRefExplorerEditorModule_PRIVATE::ERefExplorerDetailLevel BuiltDetailLevel;
+
+	/** Set once the node is painted, until then only a placeholder is built */
+	bool bIsRealized;
 };
 
 void SGraphNode_RefExplorer::Construct(const FArguments& InArgs, UEdGraphNode_RefExplorer* InNode)
 {
-	const int32 ThumbnailSize = 128;
+	GraphNode = InNode;
+	BuiltDetailLevel = FRefExplorerEditorModule_PRIVATE::ERefExplorerDetailLevel::Placeholder;
+	bIsRealized = false;
+	SetCursor(EMouseCursor::CardinalCross);
+	SetVisibility(TAttribute<EVisibility>::CreateSP(this, &SGraphNode_RefExplorer::GetNodeVisibility));
+	UpdateGraphNode();
+}
+
+void SGraphNode_RefExplorer::MoveTo(const FVector2D& NewPosition, FNodeSet& NodeFilter, bool bMarkDirty)
+{
+	SGraphNode::MoveTo(NewPosition, NodeFilter, bMarkDirty);
+
+	if (UEdGraphNode_RefExplorer* RefGraphNode = Cast<UEdGraphNode_RefExplorer>(GraphNode))
+	{
+		RefGraphNode->GetRefExplorerGraph()->MarkSpatialIndexDirty();
+		RefGraphNode->GetRefExplorerGraph()->MarkLayoutCacheDirty();
+	}
+}
+
+FRefExplorerEditorModule_PRIVATE::ERefExplorerDetailLevel SGraphNode_RefExplorer::GetDetailLevel() const
+{
+	using namespace FRefExplorerEditorModule_PRIVATE;
+
+	if (TSharedPtr<SGraphPanel> OwnerGraphPanel = OwnerGraphPanelPtr.Pin())
+	{
+		const EGraphRenderingLOD::Type LOD = OwnerGraphPanel->GetCurrentLOD();
+
+		if (LOD <= EGraphRenderingLOD::LowestDetail)
+		{
+			return ERefExplorerDetailLevel::Summary;
+		}
+		else if (LOD < EGraphRenderingLOD::DefaultDetail)
+		{
+			return ERefExplorerDetailLevel::Title;
+		}
+	}
+
+	return ERefExplorerDetailLevel::Full;
+}
+
+const FRefExplorerNodeAggregate* SGraphNode_RefExplorer::GetSummarizedAggregate() const
+{
+	UEdGraphNode_RefExplorer* RefGraphNode = CastChecked<UEdGraphNode_RefExplorer>(GraphNode);
+
+	if (RefGraphNode->GetAggregateIndex() == INDEX_NONE || GetDetailLevel() != FRefExplorerEditorModule_PRIVATE::ERefExplorerDetailLevel::Summary)
+	{
+		return nullptr;
+	}
+
+	return RefGraphNode->GetRefExplorerGraph()->GetNodeAggregate(RefGraphNode);
+}
+
+EVisibility SGraphNode_RefExplorer::GetNodeVisibility() const
+{
+	const FRefExplorerNodeAggregate* NodeAggregate = GetSummarizedAggregate();
+	return !NodeAggregate || NodeAggregate->Representative == GraphNode ? EVisibility::Visible : EVisibility::Hidden;
+}
+
+FText SGraphNode_RefExplorer::GetSummaryText() const
+{
+	if (const FRefExplorerNodeAggregate* NodeAggregate = GetSummarizedAggregate())
+	{
+		return FText::Format(LOCTEXT("AggregateSummary", "{0}\n{1} assets"), FText::FromString(NodeAggregate->Path), FText::AsNumber(NodeAggregate->Members.Num()));
+	}
+
+	return FText::GetEmpty();
+}
+
+void SGraphNode_RefExplorer::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SGraphNode::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// Only painted nodes tick, so nodes off screen keep their widgets until they are scrolled to
+	if (!bIsRealized)
+	{
+		bIsRealized = true;
+		CastChecked<UEdGraphNode_RefExplorer>(GraphNode)->GetRefExplorerGraph()->AddRealizedNodeWidget(StaticCastSharedRef<SGraphNode_RefExplorer>(AsShared()));
+	}
+
+	const FRefExplorerEditorModule_PRIVATE::ERefExplorerDetailLevel DetailLevel = GetDetailLevel();
+
+	if (DetailLevel != BuiltDetailLevel)
+	{
+		UpdateGraphNode();
+	}
+	else if (DetailLevel == FRefExplorerEditorModule_PRIVATE::ERefExplorerDetailLevel::Full)
+	{
+		CastChecked<UEdGraphNode_RefExplorer>(GraphNode)->SetFullDetailSize(GetDesiredSize());
+	}
+}
+
+TSharedRef<SWidget> SGraphNode_RefExplorer::MakeThumbnailWidget(uint32 Resolution)
+{
+	UEdGraphNode_RefExplorer* RefGraphNode = CastChecked<UEdGraphNode_RefExplorer>(GraphNode);
+
+	if (!AssetThumbnail.IsValid() || (uint32)AssetThumbnail->GetSize().X != Resolution)
+	{
+		if (RefGraphNode->UsesThumbnail())
+		{
+			// Get a thumbnail from the thumbnail cache shared by explorers
+			AssetThumbnail = RefGraphNode->GetRefExplorerGraph()->GetThumbnailCache().FindOrCreate(RefGraphNode->GetAssetData(), Resolution);
+		}
+		else if (RefGraphNode->IsPackage())
+		{
+			// Just make a generic thumbnail
+			AssetThumbnail = MakeShareable(new FAssetThumbnail(RefGraphNode->GetAssetData(), Resolution, Resolution, NULL));
+		}
+	}
+
+	if (!AssetThumbnail.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	FAssetThumbnailConfig ThumbnailConfig;
+	ThumbnailConfig.bAllowFadeIn = RefGraphNode->UsesThumbnail();
+	ThumbnailConfig.bForceGenericThumbnail = !RefGraphNode->UsesThumbnail();
+	ThumbnailConfig.AssetTypeColorOverride = FLinearColor::Transparent;
+
+	return
+		SNew(SBox)
+		.WidthOverride(Resolution)
+		.HeightOverride(Resolution)
+		[
+			AssetThumbnail->MakeThumbnailWidget(ThumbnailConfig)
+		];
+}
+
+void SGraphNode_RefExplorer::ReleaseContent()
+{
+	bIsRealized = false;
+	AssetThumbnail.Reset();
+
+	UpdateGraphNode();
+}
+
+void SGraphNode_RefExplorer::Rebind(UEdGraphNode_RefExplorer* InNode)
+{
+	// The panel sets itself as owner again when the widget is added
+	OwnerGraphPanelPtr.Reset();
+
+	GraphNode = InNode;
+	BuiltDetailLevel = FRefExplorerEditorModule_PRIVATE::ERefExplorerDetailLevel::Placeholder;
+
+	ReleaseContent();
+}
+
+void SGraphNode_RefExplorer::UpdateLowDetailGraphNode()
+{
+	using namespace FRefExplorerEditorModule_PRIVATE;
 
-	if (InNode->UsesThumbnail())
+	UEdGraphNode_RefExplorer* RefGraphNode = CastChecked<UEdGraphNode_RefExplorer>(GraphNode);
+
+	RemoveSlot(ENodeZone::TopCenter);
+
+	TSharedRef<SWidget> ContentWidget = SNullWidget::NullWidget;
+
+	if (BuiltDetailLevel == ERefExplorerDetailLevel::Title)
 	{
-		// Create a thumbnail from the graph's thumbnail pool
-		TSharedPtr<FAssetThumbnailPool> AssetThumbnailPool = InNode->GetRefExplorerGraph()->GetAssetThumbnailPool();
-		AssetThumbnail = MakeShareable(new FAssetThumbnail(InNode->GetAssetData(), ThumbnailSize, ThumbnailSize, AssetThumbnailPool));
+		// Thumbnails are too small to tell apart at this zoom when rendered at full resolution, the smaller one costs a quarter of the memory
+		ContentWidget =
+			SNew(SVerticalBox)
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.HAlign(HAlign_Center)
+				.Padding(0, 0, 0, 4)
+				[
+					MakeThumbnailWidget(THUMBNAIL_MIN_RESOLUTION)
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					SNew(STextBlock)
+						.Text(GraphNode->GetNodeTitle(ENodeTitleType::FullTitle))
+						.Justification(ETextJustify::Center)
+				];
 	}
-	else if (InNode->IsPackage())
+	else if (BuiltDetailLevel == ERefExplorerDetailLevel::Summary)
 	{
-		// Just make a generic thumbnail
-		AssetThumbnail = MakeShareable(new FAssetThumbnail(InNode->GetAssetData(), ThumbnailSize, ThumbnailSize, NULL));
+		AssetThumbnail.Reset();
+
+		// Folder paths are long, the glyph shrinks to fit the node instead of spilling over its neighbours
+		ContentWidget =
+			SNew(SScaleBox)
+				.Stretch(EStretch::ScaleToFit)
+				.StretchDirection(EStretchDirection::DownOnly)
+				[
+					SNew(STextBlock)
+						.Text(this, &SGraphNode_RefExplorer::GetSummaryText)
+						.Font(SummaryBold)
+						.Justification(ETextJustify::Center)
+				];
 	}
 
-	GraphNode = InNode;
-	SetCursor(EMouseCursor::CardinalCross);
-	UpdateGraphNode();
+	// Same footprint as the full node, so wires and free space look the same at every zoom
+	const FVector2D FullDetailSize = RefGraphNode->GetFullDetailSize().IsNearlyZero() ? LAYOUT_NODE_SIZE : RefGraphNode->GetFullDetailSize();
+
+	ContentScale.Bind(this, &SGraphNode_RefExplorer::GetContentScale);
+	GetOrAddSlot(ENodeZone::Center)
+		.HAlign(HAlign_Center)
+		.VAlign(VAlign_Center)
+		[
+			SNew(SBox)
+				.WidthOverride(FullDetailSize.X)
+				.HeightOverride(FullDetailSize.Y)
+				[
+					SNew(SBorder)
+						.BorderImage(FAppStyle::GetBrush("WhiteBrush"))
+						.BorderBackgroundColor(this, &SGraphNode_RefExplorer::GetNodeTitleColor)
+						.Padding(0)
+						[
+							SNew(SHorizontalBox)
+								+ SHorizontalBox::Slot()
+								.AutoWidth()
+								.VAlign(VAlign_Center)
+								[
+									SAssignNew(LeftNodeBox, SVerticalBox)
+								]
+								+ SHorizontalBox::Slot()
+								.FillWidth(1.0f)
+								.HAlign(HAlign_Center)
+								.VAlign(VAlign_Center)
+								[
+									ContentWidget
+								]
+								+ SHorizontalBox::Slot()
+								.AutoWidth()
+								.VAlign(VAlign_Center)
+								[
+									SAssignNew(RightNodeBox, SVerticalBox)
+								]
+						]
+				]
+		];
+
+	CreatePinWidgets();
 }
 
 // UpdateGraphNode is similar to the base, but adds the option to hide the thumbnail */
 void SGraphNode_RefExplorer::UpdateGraphNode()
 {
+	// Pins are recreated whenever the zoom changes the detail level
+	InputPins.Empty();
 	OutputPins.Empty();
 
 	// Reset variables that are going to be exposed, in case we are refreshing an already setup node.
 	RightNodeBox.Reset();
 	LeftNodeBox.Reset();
 
+	BuiltDetailLevel = bIsRealized ? GetDetailLevel() : FRefExplorerEditorModule_PRIVATE::ERefExplorerDetailLevel::Placeholder;
+
+	if (BuiltDetailLevel != FRefExplorerEditorModule_PRIVATE::ERefExplorerDetailLevel::Full)
+	{
+		UpdateLowDetailGraphNode();
+		return;
+	}
+
 	UpdateErrorInfo();
 
 	//
@@ -1194,63 +5086,16 @@ void SGraphNode_RefExplorer::UpdateGraphNode()
 		IconBrush = GraphNode->GetIconAndTint(IconColor).GetOptionalIcon();
 	}
 
-	TSharedRef<SWidget> ThumbnailWidget = SNullWidget::NullWidget;
 	UEdGraphNode_RefExplorer* RefGraphNode = CastChecked<UEdGraphNode_RefExplorer>(GraphNode);
 
-	FLinearColor OpacityColor = FLinearColor::White;
-
-	if (AssetThumbnail.IsValid())
-	{
-		FAssetThumbnailConfig ThumbnailConfig;
-		ThumbnailConfig.bAllowFadeIn = RefGraphNode->UsesThumbnail();
-		ThumbnailConfig.bForceGenericThumbnail = !RefGraphNode->UsesThumbnail();
-		ThumbnailConfig.AssetTypeColorOverride = FLinearColor::Transparent;
-
-		ThumbnailWidget =
-			SNew(SBox)
-			.WidthOverride(AssetThumbnail->GetSize().X)
-			.HeightOverride(AssetThumbnail->GetSize().Y)
-			[
-				AssetThumbnail->MakeThumbnailWidget(ThumbnailConfig)
-			];
-	}
-
-	TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo> refPropInfos;
-
-	if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(GraphNode))
-	{
-		UEdGraph_RefExplorer* RefExplorerGraph = RefExplorerNode->GetRefExplorerGraph();
-
-		if (UObject* rootAsset = RefExplorerGraph->GetGraphRootNodeInfo().AssetData.GetAsset())
-		{
-			if (UObject* refAsset = RefExplorerNode->GetAssetData().GetAsset())
-			{
-				if (rootAsset != refAsset)
-				{
-					if (UBlueprint* refBlueprint = Cast<UBlueprint>(refAsset))
-					{
-						UObject* genClassDefaultObject = refBlueprint->GeneratedClass->GetDefaultObject();
-
-						FRefExplorerEditorModule_PRIVATE::FindRecursive(refBlueprint->GeneratedClass, genClassDefaultObject, rootAsset, refPropInfos, false);
-					}
-					else if (UScriptStruct* refStruct = Cast<UScriptStruct>(refAsset))
-					{
-						const int32 structureSize = refStruct->GetStructureSize();
-						uint8* structDefault = new uint8[structureSize];
-						refStruct->InitializeDefaultValue(structDefault);
+	// Thumbnails are only made for realized nodes and released with their widgets
+	TSharedRef<SWidget> ThumbnailWidget = MakeThumbnailWidget(FRefExplorerEditorModule_PRIVATE::THUMBNAIL_MAX_RESOLUTION);
 
-						FRefExplorerEditorModule_PRIVATE::FindRecursive(refStruct, structDefault, rootAsset, refPropInfos, false);
+	FLinearColor OpacityColor = FLinearColor::White;
 
-						delete[] structDefault;
-					}
-					else if (UClass* refAssetClass = refAsset->GetClass())
-					{
-						FRefExplorerEditorModule_PRIVATE::FindRecursive(refAssetClass, refAsset, rootAsset, refPropInfos, false);
-					}
-				}
-			}
-		}
-	}
+	// Property pins already list the referencing properties
+	static const TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo> EmptyRefPropInfos;
+	const TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo>& refPropInfos = RefGraphNode->HasPropertyPins() ? EmptyRefPropInfos : RefGraphNode->GetRefExplorerGraph()->GetRefPropInfos(RefGraphNode);
 
 	TSharedRef<SWidget> refPropsWidget = SNullWidget::NullWidget;
 
@@ -1417,7 +5262,8 @@ void SGraphNode_RefExplorer::UpdateGraphNode()
 														[
 															// RIGHT
 															SNew(SBox)
-																.WidthOverride(40)
+																.WidthOverride(RefGraphNode->HasPropertyPins() ? FOptionalSize() : FOptionalSize(40))
+																.MinDesiredWidth(40)
 																[
 																	SAssignNew(RightNodeBox, SVerticalBox)
 																]
@@ -1429,31 +5275,497 @@ void SGraphNode_RefExplorer::UpdateGraphNode()
 				]
 		];
 
-	// Create comment bubble if comment text is valid
-	GetNodeObj()->bCommentBubbleVisible = !GetNodeObj()->NodeComment.IsEmpty();
-	if (GetNodeObj()->ShouldMakeCommentBubbleVisible() && GetNodeObj()->bCommentBubbleVisible)
+	// Create comment bubble if comment text is valid
+	GetNodeObj()->bCommentBubbleVisible = !GetNodeObj()->NodeComment.IsEmpty();
+	if (GetNodeObj()->ShouldMakeCommentBubbleVisible() && GetNodeObj()->bCommentBubbleVisible)
+	{
+		TSharedPtr<SCommentBubble> CommentBubble;
+
+		SAssignNew(CommentBubble, SCommentBubble)
+			.GraphNode(GraphNode)
+			.Text(this, &SGraphNode::GetNodeComment);
+
+		GetOrAddSlot(ENodeZone::TopCenter)
+			.SlotOffset(TAttribute<FVector2D>(CommentBubble.Get(), &SCommentBubble::GetOffset))
+			.SlotSize(TAttribute<FVector2D>(CommentBubble.Get(), &SCommentBubble::GetSize))
+			.AllowScaling(TAttribute<bool>(CommentBubble.Get(), &SCommentBubble::IsScalingAllowed))
+			.VAlign(VAlign_Top)
+			[
+				CommentBubble.ToSharedRef()
+			];
+	}
+
+	ErrorReporting = ErrorText;
+	ErrorReporting->SetError(ErrorMsg);
+	CreateBelowWidgetControls(MainVerticalBox);
+
+	CreatePinWidgets();
+}
+
+//------------------------------------------------------
+// SRefExplorerLitePanel
+//------------------------------------------------------
+
+/** Draws a lite graph with one draw element for all node boxes and one for all wires, labels only for nodes in view when zoomed in */
+class SRefExplorerLitePanel : public SLeafWidget
+{
+public:
+	DECLARE_DELEGATE_OneParam(FOnNodeDoubleClicked, const FRefExplorerLiteNode&);
+
+	SLATE_BEGIN_ARGS(SRefExplorerLitePanel) {}
+		SLATE_EVENT(FOnNodeDoubleClicked, OnNodeDoubleClicked)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, UEdGraph_RefExplorer* InGraph);
+
+	/** Fits the whole graph into view, once the panel has a size */
+	FORCEINLINE void ZoomToFit() { bZoomToFitPending = true; }
+
+	/** Gets the part of the graph in view, in graph space */
+	FORCEINLINE FBox2D GetViewRect() const { return FBox2D(ViewOffset, LocalToGraph(GetTickSpaceGeometry().GetLocalSize())); }
+	FORCEINLINE void CenterOn(const FVector2D& GraphLocation) { ViewOffset = GraphLocation - GetTickSpaceGeometry().GetLocalSize() * 0.5f / ZoomAmount; }
+
+	// SWidget interface
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override { return FVector2D(128.f, 128.f); }
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	// End of SWidget interface
+
+private:
+	FORCEINLINE FVector2D GraphToLocal(const FVector2D& GraphLocation) const { return (GraphLocation - ViewOffset) * ZoomAmount; }
+	FORCEINLINE FVector2D LocalToGraph(const FVector2D& LocalLocation) const { return ViewOffset + LocalLocation / ZoomAmount; }
+
+	UEdGraph_RefExplorer* Graph;
+
+	FOnNodeDoubleClicked OnNodeDoubleClicked;
+
+	/** Graph location at the top left of the panel */
+	FVector2D ViewOffset;
+	float ZoomAmount;
+
+	uint32 FittedLayoutSerial;
+	bool bZoomToFitPending;
+};
+
+void SRefExplorerLitePanel::Construct(const FArguments& InArgs, UEdGraph_RefExplorer* InGraph)
+{
+	Graph = InGraph;
+	OnNodeDoubleClicked = InArgs._OnNodeDoubleClicked;
+
+	ViewOffset = FVector2D::ZeroVector;
+	ZoomAmount = 1.f;
+
+	FittedLayoutSerial = 0;
+	bZoomToFitPending = false;
+
+	SetClipping(EWidgetClipping::ClipToBounds);
+}
+
+void SRefExplorerLitePanel::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	if (!Graph || !Graph->IsLite())
+	{
+		return;
+	}
+
+	const FRefExplorerLiteGraph& LiteGraph = Graph->GetLiteGraph();
+
+	// Layout lands after the graph was built, zoom to it once it does
+	if (FittedLayoutSerial != LiteGraph.LayoutSerial)
+	{
+		FittedLayoutSerial = LiteGraph.LayoutSerial;
+		bZoomToFitPending = true;
+	}
+
+	const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+
+	if (bZoomToFitPending && LiteGraph.Bounds.bIsValid && LocalSize.X > 0.f && LocalSize.Y > 0.f)
+	{
+		const FVector2D BoundsSize = LiteGraph.Bounds.GetSize();
+
+		ZoomAmount = FMath::Clamp(0.9f * FMath::Min(LocalSize.X / BoundsSize.X, LocalSize.Y / BoundsSize.Y), FRefExplorerEditorModule_PRIVATE::LITE_MIN_ZOOM, FRefExplorerEditorModule_PRIVATE::LITE_MAX_ZOOM);
+		ViewOffset = LiteGraph.Bounds.GetCenter() - LocalSize * 0.5f / ZoomAmount;
+
+		bZoomToFitPending = false;
+	}
+}
+
+int32 SRefExplorerLitePanel::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), FAppStyle::GetBrush("Graph.Panel.SolidBackground"));
+
+	if (!Graph || !Graph->IsLite() || !Graph->GetLiteGraph().Bounds.bIsValid)
+	{
+		return LayerId;
+	}
+
+	const FRefExplorerLiteGraph& LiteGraph = Graph->GetLiteGraph();
+
+	const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+	const FBox2D ViewRect(LocalToGraph(FVector2D::ZeroVector), LocalToGraph(LocalSize));
+	const FVector2D NodeSize = FRefExplorerEditorModule_PRIVATE::LITE_NODE_SIZE;
+
+	const FSlateRenderTransform& RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
+	const FSlateResourceHandle ResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*FCoreStyle::Get().GetBrush("WhiteBrush"));
+
+	TArray<FSlateVertex> Vertices;
+	TArray<SlateIndex> Indices;
+
+	// Wires, from the right side of referencers to the left side of what they reference
+
+	const float HalfThickness = FMath::Max(FRefExplorerEditorModule_PRIVATE::LITE_WIRE_THICKNESS * ZoomAmount, 1.f) * 0.5f;
+
+	for (const FRefExplorerLiteEdge& Edge : LiteGraph.Edges)
+	{
+		const FVector2D Start = LiteGraph.Nodes[Edge.Referencer].Position + FVector2D(NodeSize.X, NodeSize.Y * 0.5f);
+		const FVector2D End = LiteGraph.Nodes[Edge.Referenced].Position + FVector2D(0.f, NodeSize.Y * 0.5f);
+
+		if (!ViewRect.Intersect(FBox2D(Start.ComponentMin(End), Start.ComponentMax(End))))
+		{
+			continue;
+		}
+
+		const FVector2D LocalStart = GraphToLocal(Start);
+		const FVector2D LocalEnd = GraphToLocal(End);
+		const FVector2D Normal = (LocalEnd - LocalStart).GetSafeNormal().GetRotated(90.f) * HalfThickness;
+
+		const FVector2D Corners[4] = { LocalStart + Normal, LocalStart - Normal, LocalEnd - Normal, LocalEnd + Normal };
+		FRefExplorerEditorModule_PRIVATE::AddQuad(OutDrawElements, LayerId + 1, ResourceHandle, RenderTransform, Corners, FRefExplorerEditorModule_PRIVATE::GetColor(Edge.Category).ToFColor(true), Vertices, Indices);
+	}
+
+	if (!Vertices.IsEmpty())
+	{
+		FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 1, ResourceHandle, Vertices, Indices, nullptr, 0, 0);
+
+		Vertices.Reset();
+		Indices.Reset();
+	}
+
+	// Node boxes, labels are only drawn when they are big enough to read
+
+	const bool bDrawLabels = ZoomAmount >= FRefExplorerEditorModule_PRIVATE::LITE_LABEL_MIN_ZOOM;
+	TArray<int32> LabeledNodes;
+
+	for (int32 NodeIndex = 0; NodeIndex < LiteGraph.Nodes.Num(); NodeIndex++)
+	{
+		const FRefExplorerLiteNode& Node = LiteGraph.Nodes[NodeIndex];
+
+		if (!ViewRect.Intersect(FBox2D(Node.Position, Node.Position + NodeSize)))
+		{
+			continue;
+		}
+
+		const FVector2D TopLeft = GraphToLocal(Node.Position);
+		const FVector2D BottomRight = GraphToLocal(Node.Position + NodeSize);
+
+		const FVector2D Corners[4] = { TopLeft, FVector2D(BottomRight.X, TopLeft.Y), BottomRight, FVector2D(TopLeft.X, BottomRight.Y) };
+		FRefExplorerEditorModule_PRIVATE::AddQuad(OutDrawElements, LayerId + 2, ResourceHandle, RenderTransform, Corners, (Node.Color * (NodeIndex == 0 ? 1.f : 0.6f)).CopyWithNewOpacity(1.f).ToFColor(true), Vertices, Indices);
+
+		if (bDrawLabels)
+		{
+			LabeledNodes.Add(NodeIndex);
+		}
+	}
+
+	if (!Vertices.IsEmpty())
+	{
+		FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 2, ResourceHandle, Vertices, Indices, nullptr, 0, 0);
+	}
+
+	for (const int32 NodeIndex : LabeledNodes)
+	{
+		const FRefExplorerLiteNode& Node = LiteGraph.Nodes[NodeIndex];
+		const FVector2D LabelOffset(8.f, 8.f);
+
+		FSlateDrawElement::MakeText(OutDrawElements, LayerId + 3, AllottedGeometry.ToPaintGeometry(NodeSize - LabelOffset * 2.f, FSlateLayoutTransform(ZoomAmount, GraphToLocal(Node.Position + LabelOffset))), Node.Label, FRefExplorerEditorModule_PRIVATE::LiteLabel, ESlateDrawEffect::None, FLinearColor::White);
+	}
+
+	return LayerId + 3;
+}
+
+FReply SRefExplorerLitePanel::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton || MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
+	{
+		return FReply::Handled().CaptureMouse(SharedThis(this));
+	}
+
+	return FReply::Unhandled();
+}
+
+FReply SRefExplorerLitePanel::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (HasMouseCapture())
+	{
+		return FReply::Handled().ReleaseMouseCapture();
+	}
+
+	return FReply::Unhandled();
+}
+
+FReply SRefExplorerLitePanel::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (HasMouseCapture())
+	{
+		ViewOffset -= MouseEvent.GetCursorDelta() / (ZoomAmount * MyGeometry.Scale);
+		return FReply::Handled();
+	}
+
+	return FReply::Unhandled();
+}
+
+FReply SRefExplorerLitePanel::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	// Zooms around the cursor, the graph location under it stays put
+	const FVector2D LocalCursor = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+	const FVector2D GraphCursor = LocalToGraph(LocalCursor);
+
+	ZoomAmount = FMath::Clamp(ZoomAmount * (MouseEvent.GetWheelDelta() > 0.f ? 1.25f : 0.8f), FRefExplorerEditorModule_PRIVATE::LITE_MIN_ZOOM, FRefExplorerEditorModule_PRIVATE::LITE_MAX_ZOOM);
+	ViewOffset = GraphCursor - LocalCursor / ZoomAmount;
+
+	return FReply::Handled();
+}
+
+FReply SRefExplorerLitePanel::OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (Graph && Graph->IsLite())
+	{
+		const FRefExplorerLiteGraph& LiteGraph = Graph->GetLiteGraph();
+		const int32 NodeIndex = LiteGraph.FindNodeAt(LocalToGraph(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition())));
+
+		if (NodeIndex != INDEX_NONE)
+		{
+			// Copied, the handler rebuilds the graph
+			const FRefExplorerLiteNode Node = LiteGraph.Nodes[NodeIndex];
+			OnNodeDoubleClicked.ExecuteIfBound(Node);
+
+			return FReply::Handled();
+		}
+	}
+
+	return FReply::Unhandled();
+}
+
+//------------------------------------------------------
+// SRefExplorerMinimap
+//------------------------------------------------------
+
+/** Overview of all nodes as dots, rasterized into a small texture only when the layout changes. Clicking or dragging moves the view there */
+class SRefExplorerMinimap : public SLeafWidget
+{
+public:
+	DECLARE_DELEGATE_OneParam(FOnJumpTo, const FVector2D&);
+
+	SLATE_BEGIN_ARGS(SRefExplorerMinimap) {}
+		SLATE_ATTRIBUTE(FBox2D, ViewRect)
+		SLATE_EVENT(FOnJumpTo, OnJumpTo)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, UEdGraph_RefExplorer* InGraph);
+
+	// SWidget interface
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override { return FVector2D(FRefExplorerEditorModule_PRIVATE::MINIMAP_SIZE); }
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	// End of SWidget interface
+
+private:
+	/** Redraws all nodes into the raster texture */
+	void UpdateRaster();
+
+	/** Raster pixels map to graph space with a uniform scale, RasterBounds is laid over the whole minimap */
+	FORCEINLINE FVector2D GraphToLocal(const FVector2D& GraphLocation) const { return (GraphLocation - RasterBounds.Min) / RasterScale; }
+	FORCEINLINE FVector2D LocalToGraph(const FVector2D& LocalLocation) const { return RasterBounds.Min + LocalLocation * RasterScale; }
+
+	void JumpTo(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent);
+
+	UEdGraph_RefExplorer* Graph;
+
+	TAttribute<FBox2D> ViewRect;
+	FOnJumpTo OnJumpTo;
+
+	TStrongObjectPtr<UTexture2D> RasterTexture;
+	FSlateBrush RasterBrush;
+
+	FBox2D RasterBounds;
+	double RasterScale;
+
+	uint32 RasterLayoutVersion;
+	double RasterTime;
+};
+
+void SRefExplorerMinimap::Construct(const FArguments& InArgs, UEdGraph_RefExplorer* InGraph)
+{
+	Graph = InGraph;
+	ViewRect = InArgs._ViewRect;
+	OnJumpTo = InArgs._OnJumpTo;
+
+	RasterBounds = FBox2D(ForceInit);
+	RasterScale = 1.0;
+
+	// Out of date, so the first tick draws it
+	RasterLayoutVersion = Graph ? Graph->GetLayoutVersion() - 1 : 0;
+	RasterTime = 0.0;
+
+	SetClipping(EWidgetClipping::ClipToBounds);
+}
+
+void SRefExplorerMinimap::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	// Force directed layout moves nodes every frame while it settles, so the raster follows at a lower rate
+	if (Graph && Graph->GetLayoutVersion() != RasterLayoutVersion && InCurrentTime - RasterTime >= FRefExplorerEditorModule_PRIVATE::MINIMAP_UPDATE_INTERVAL)
+	{
+		RasterLayoutVersion = Graph->GetLayoutVersion();
+		RasterTime = InCurrentTime;
+
+		UpdateRaster();
+	}
+}
+
+void SRefExplorerMinimap::UpdateRaster()
+{
+	const FIntPoint Size = FRefExplorerEditorModule_PRIVATE::MINIMAP_SIZE;
+
+	TArray<TPair<FBox2D, FLinearColor>> NodeRects;
+	Graph->GetNodeRects(NodeRects);
+
+	FBox2D Bounds(ForceInit);
+
+	for (const TPair<FBox2D, FLinearColor>& NodeRect : NodeRects)
+	{
+		Bounds += NodeRect.Key;
+	}
+
+	if (!Bounds.bIsValid)
+	{
+		RasterBounds = Bounds;
+		return;
+	}
+
+	// Widened to the aspect of the minimap, with a margin
+	RasterScale = 1.1 * FMath::Max(Bounds.GetSize().X / Size.X, Bounds.GetSize().Y / Size.Y);
+	RasterBounds = FBox2D(Bounds.GetCenter() - FVector2D(Size) * RasterScale * 0.5, Bounds.GetCenter() + FVector2D(Size) * RasterScale * 0.5);
+
+	TArray<FColor>* Pixels = new TArray<FColor>();
+	Pixels->Init(FColor::Transparent, Size.X * Size.Y);
+
+	// Every node covers at least a pixel, however far zoomed out
+	for (const TPair<FBox2D, FLinearColor>& NodeRect : NodeRects)
+	{
+		const FVector2D Min = GraphToLocal(NodeRect.Key.Min);
+		const FVector2D Max = GraphToLocal(NodeRect.Key.Max);
+
+		const int32 MinX = FMath::Clamp(FMath::FloorToInt(Min.X), 0, Size.X - 1);
+		const int32 MinY = FMath::Clamp(FMath::FloorToInt(Min.Y), 0, Size.Y - 1);
+		const int32 MaxX = FMath::Clamp(FMath::FloorToInt(Max.X), MinX, Size.X - 1);
+		const int32 MaxY = FMath::Clamp(FMath::FloorToInt(Max.Y), MinY, Size.Y - 1);
+
+		const FColor Color = NodeRect.Value.CopyWithNewOpacity(1.f).ToFColor(true);
+
+		for (int32 Y = MinY; Y <= MaxY; Y++)
+		{
+			for (int32 X = MinX; X <= MaxX; X++)
+			{
+				(*Pixels)[Y * Size.X + X] = Color;
+			}
+		}
+	}
+
+	if (!RasterTexture.IsValid())
+	{
+		UTexture2D* Texture = UTexture2D::CreateTransient(Size.X, Size.Y, PF_B8G8R8A8);
+		Texture->Filter = TF_Nearest;
+		Texture->SRGB = true;
+		Texture->UpdateResource();
+
+		RasterTexture.Reset(Texture);
+
+		RasterBrush.SetResourceObject(Texture);
+		RasterBrush.ImageSize = FVector2D(Size);
+		RasterBrush.DrawAs = ESlateBrushDrawType::Image;
+	}
+
+	// Written in place on the render thread, which frees the copies once done
+	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, Size.X, Size.Y);
+
+	RasterTexture->UpdateTextureRegions(0, 1, Region, Size.X * sizeof(FColor), sizeof(FColor), reinterpret_cast<uint8*>(Pixels->GetData()), [Pixels](uint8* SrcData, const FUpdateTextureRegion2D* Regions)
+		{
+			delete Pixels;
+			delete Regions;
+		});
+}
+
+int32 SRefExplorerMinimap::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), FAppStyle::GetBrush("Brushes.Recessed"), ESlateDrawEffect::None, FLinearColor(1.f, 1.f, 1.f, 0.8f));
+
+	if (!RasterTexture.IsValid() || !RasterBounds.bIsValid)
+	{
+		return LayerId;
+	}
+
+	FSlateDrawElement::MakeBox(OutDrawElements, LayerId + 1, AllottedGeometry.ToPaintGeometry(), &RasterBrush);
+
+	const FBox2D View = ViewRect.Get();
+
+	if (View.bIsValid)
+	{
+		const FVector2D Min = GraphToLocal(View.Min);
+		const FVector2D Max = GraphToLocal(View.Max);
+
+		const TArray<FVector2f> Points = { FVector2f(Min), FVector2f(FVector2D(Max.X, Min.Y)), FVector2f(Max), FVector2f(FVector2D(Min.X, Max.Y)), FVector2f(Min) };
+		FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 2, AllottedGeometry.ToPaintGeometry(), Points, ESlateDrawEffect::None, FLinearColor::White, true, 1.f);
+	}
+
+	return LayerId + 2;
+}
+
+void SRefExplorerMinimap::JumpTo(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (RasterBounds.bIsValid)
 	{
-		TSharedPtr<SCommentBubble> CommentBubble;
+		OnJumpTo.ExecuteIfBound(LocalToGraph(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition())));
+	}
+}
 
-		SAssignNew(CommentBubble, SCommentBubble)
-			.GraphNode(GraphNode)
-			.Text(this, &SGraphNode::GetNodeComment);
+FReply SRefExplorerMinimap::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
+	{
+		JumpTo(MyGeometry, MouseEvent);
+		return FReply::Handled().CaptureMouse(SharedThis(this));
+	}
 
-		GetOrAddSlot(ENodeZone::TopCenter)
-			.SlotOffset(TAttribute<FVector2D>(CommentBubble.Get(), &SCommentBubble::GetOffset))
-			.SlotSize(TAttribute<FVector2D>(CommentBubble.Get(), &SCommentBubble::GetSize))
-			.AllowScaling(TAttribute<bool>(CommentBubble.Get(), &SCommentBubble::IsScalingAllowed))
-			.VAlign(VAlign_Top)
-			[
-				CommentBubble.ToSharedRef()
-			];
+	return FReply::Unhandled();
+}
+
+FReply SRefExplorerMinimap::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (HasMouseCapture())
+	{
+		return FReply::Handled().ReleaseMouseCapture();
 	}
 
-	ErrorReporting = ErrorText;
-	ErrorReporting->SetError(ErrorMsg);
-	CreateBelowWidgetControls(MainVerticalBox);
+	return FReply::Unhandled();
+}
 
-	CreatePinWidgets();
+FReply SRefExplorerMinimap::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (HasMouseCapture())
+	{
+		JumpTo(MyGeometry, MouseEvent);
+		return FReply::Handled();
+	}
+
+	return FReply::Unhandled();
 }
 
 //------------------------------------------------------
@@ -1464,22 +5776,53 @@ TSharedPtr<SGraphNode> FRefExplorerGraphNodeFactory::CreateNode(UEdGraphNode* In
 {
 	if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(InNode))
 	{
-		return SNew(SGraphNode_RefExplorer, RefExplorerNode);
+		return RefExplorerNode->GetRefExplorerGraph()->AcquireNodeWidget(RefExplorerNode);
 	}
 
 	return nullptr;
 }
 
+TSharedRef<SGraphNode_RefExplorer> UEdGraph_RefExplorer::AcquireNodeWidget(UEdGraphNode_RefExplorer* Node)
+{
+	// Refreshes without a rebuild drop widgets behind the cursor, so the pool is searched again once per frame
+	if (NodeWidgetPoolCursor >= NodeWidgetPool.Num() && NodeWidgetPoolWrapFrame != GFrameCounter)
+	{
+		NodeWidgetPoolCursor = 0;
+		NodeWidgetPoolWrapFrame = GFrameCounter;
+	}
+
+	while (NodeWidgetPoolCursor < NodeWidgetPool.Num())
+	{
+		const TSharedRef<SGraphNode_RefExplorer>& NodeWidget = NodeWidgetPool[NodeWidgetPoolCursor++];
+
+		if (NodeWidget.IsUnique())
+		{
+			NodeWidget->Rebind(Node);
+			return NodeWidget;
+		}
+	}
+
+	TSharedRef<SGraphNode_RefExplorer> NodeWidget = SNew(SGraphNode_RefExplorer, Node);
+
+	NodeWidgetPool.Add(NodeWidget);
+	NodeWidgetPoolCursor = NodeWidgetPool.Num();
+
+	return NodeWidget;
+}
+
 //--------------------------------------------------------------------
 // SRefExplorer
 //--------------------------------------------------------------------
 
 SRefExplorer::~SRefExplorer()
 {
+	UPackage::PackageDirtyStateChangedEvent.Remove(PackageDirtyStateChangedHandle);
+
 	if (!GExitPurge)
 	{
 		if (ensure(GraphObj))
 		{
+			GraphObj->FlushLayoutCache();
 			GraphObj->RemoveFromRoot();
 		}
 	}
@@ -1497,6 +5840,7 @@ void SRefExplorer::Construct(const FArguments& InArgs)
 	GraphObj->Schema = URefExplorerSchema::StaticClass();
 	GraphObj->AddToRoot();
 	GraphObj->SetRefExplorer(StaticCastSharedRef<SRefExplorer>(AsShared()));
+	GraphObj->SetShowUnsavedReferences(true);
 
 	SGraphEditor::FGraphEditorEvents GraphEvents;
 	GraphEvents.OnNodeDoubleClicked = FSingleNodeEvent::CreateSP(this, &SRefExplorer::OnNodeDoubleClicked);
@@ -1509,6 +5853,10 @@ void SRefExplorer::Construct(const FArguments& InArgs)
 		.GraphEvents(GraphEvents)
 		.ShowGraphStateOverlay(false);
 
+	RegisterActiveTimer(FRefExplorerEditorModule_PRIVATE::VIRTUALIZATION_INTERVAL, FWidgetActiveTimerDelegate::CreateSP(this, &SRefExplorer::ReleaseOffscreenNodeWidgets));
+
+	PackageDirtyStateChangedHandle = UPackage::PackageDirtyStateChangedEvent.AddSP(this, &SRefExplorer::OnPackageDirtyStateChanged);
+
 	FEditorWidgetsModule& EditorWidgetsModule = FModuleManager::LoadModuleChecked<FEditorWidgetsModule>("EditorWidgets");
 	TSharedRef<SWidget> AssetDiscoveryIndicator = EditorWidgetsModule.CreateAssetDiscoveryIndicator(EAssetDiscoveryIndicatorScaleMode::Scale_None, FMargin(16, 8), false);
 
@@ -1518,6 +5866,7 @@ void SRefExplorer::Construct(const FArguments& InArgs)
 
 	// Visual options visibility
 	bDirtyResults = false;
+	bShowMinimap = true;
 
 	ChildSlot
 		[
@@ -1565,7 +5914,29 @@ void SRefExplorer::Construct(const FArguments& InArgs)
 
 						+ SOverlay::Slot()
 						[
-							GraphEditorPtr.ToSharedRef()
+							SNew(SBox)
+								.Visibility_Lambda([this]() { return GraphObj && GraphObj->IsLite() ? EVisibility::Collapsed : EVisibility::Visible; })
+								[
+									GraphEditorPtr.ToSharedRef()
+								]
+						]
+
+						+ SOverlay::Slot()
+						[
+							SAssignNew(LitePanelPtr, SRefExplorerLitePanel, GraphObj)
+								.Visibility_Lambda([this]() { return GraphObj && GraphObj->IsLite() ? EVisibility::Visible : EVisibility::Collapsed; })
+								.OnNodeDoubleClicked(this, &SRefExplorer::OnLiteNodeDoubleClicked)
+						]
+
+						+ SOverlay::Slot()
+						.HAlign(HAlign_Right)
+						.VAlign(VAlign_Bottom)
+						.Padding(FMargin(0, 0, 16, 16))
+						[
+							SNew(SRefExplorerMinimap, GraphObj)
+								.Visibility_Lambda([this]() { return bShowMinimap ? EVisibility::Visible : EVisibility::Collapsed; })
+								.ViewRect(this, &SRefExplorer::GetViewRect)
+								.OnJumpTo(this, &SRefExplorer::JumpTo)
 						]
 
 						+ SOverlay::Slot()
@@ -1591,8 +5962,28 @@ void SRefExplorer::Construct(const FArguments& InArgs)
 						.VAlign(VAlign_Bottom)
 						.Padding(FMargin(0, 0, 0, 16))
 						[
-							SNew(STextBlock)
-								.Text(this, &SRefExplorer::GetStatusText)
+							SNew(SVerticalBox)
+
+								+ SVerticalBox::Slot()
+								.AutoHeight()
+								.HAlign(HAlign_Center)
+								[
+									SNew(STextBlock)
+										.Text(this, &SRefExplorer::GetStatusText)
+								]
+
+								+ SVerticalBox::Slot()
+								.AutoHeight()
+								.Padding(FMargin(0, 4, 0, 0))
+								[
+									SNew(SBox)
+										.WidthOverride(240)
+										.Visibility_Lambda([this]() { return GraphObj && GraphObj->IsPopulating() ? EVisibility::Visible : EVisibility::Collapsed; })
+										[
+											SNew(SProgressBar)
+												.Percent_Lambda([this]() -> TOptional<float> { return GraphObj && GraphObj->GetNumQueuedNodes() > 0 ? float(GraphObj->GetNumCreatedNodes()) / GraphObj->GetNumQueuedNodes() : 0.f; })
+										]
+								]
 						]
 				]
 		];
@@ -1612,16 +6003,76 @@ void SRefExplorer::SetGraphRootIdentifier(const FAssetIdentifier& NewGraphRootId
 	RegisterActiveTimer(0.1f, FWidgetActiveTimerDelegate::CreateSP(this, &SRefExplorer::TriggerZoomToFit));
 }
 
+EActiveTimerReturnType SRefExplorer::ReleaseOffscreenNodeWidgets(double InCurrentTime, float InDeltaTime)
+{
+	if (!GraphObj || !GraphEditorPtr.IsValid() || GraphObj->RealizedNodeWidgets.IsEmpty())
+	{
+		return EActiveTimerReturnType::Continue;
+	}
+
+	FVector2D ViewLocation;
+	float ZoomAmount = 1.f;
+	GraphEditorPtr->GetViewLocation(ViewLocation, ZoomAmount);
+
+	const FVector2D ViewSize = FVector2D(GraphEditorPtr->GetTickSpaceGeometry().GetLocalSize()) / FMath::Max(ZoomAmount, KINDA_SMALL_NUMBER);
+	const FVector2D Margin = ViewSize * FRefExplorerEditorModule_PRIVATE::VIRTUALIZATION_MARGIN;
+
+	TArray<UEdGraphNode_RefExplorer*> NodesNearView;
+	GraphObj->FindNodesInRect(FBox2D(ViewLocation - Margin, ViewLocation + ViewSize + Margin), NodesNearView);
+
+	const FBox2D ViewRect(ViewLocation, ViewLocation + ViewSize);
+	TArray<TSharedPtr<FAssetThumbnail>> ThumbnailsInView;
+
+	TSet<const UEdGraphNode*> NodesToKeep;
+	NodesToKeep.Reserve(NodesNearView.Num());
+
+	for (const UEdGraphNode_RefExplorer* Node : NodesNearView)
+	{
+		NodesToKeep.Add(Node);
+	}
+
+	for (int32 WidgetIdx = GraphObj->RealizedNodeWidgets.Num() - 1; WidgetIdx >= 0; WidgetIdx--)
+	{
+		TSharedPtr<SGraphNode_RefExplorer> NodeWidget = GraphObj->RealizedNodeWidgets[WidgetIdx].Pin();
+
+		if (!NodeWidget.IsValid() || !NodesToKeep.Contains(NodeWidget->GetNodeObj()))
+		{
+			if (NodeWidget.IsValid())
+			{
+				NodeWidget->ReleaseContent();
+			}
+
+			GraphObj->RealizedNodeWidgets.RemoveAtSwap(WidgetIdx);
+		}
+		else if (NodeWidget->GetAssetThumbnail().IsValid() && ViewRect.IsInside(NodeWidget->GetPosition()))
+		{
+			ThumbnailsInView.Add(NodeWidget->GetAssetThumbnail());
+		}
+	}
+
+	// Nodes in the margin may have asked first, nodes in view are rendered before them
+	if (!ThumbnailsInView.IsEmpty())
+	{
+		GraphObj->GetThumbnailCache().Prioritize(ThumbnailsInView);
+	}
+
+	return EActiveTimerReturnType::Continue;
+}
+
 EActiveTimerReturnType SRefExplorer::TriggerZoomToFit(double InCurrentTime, float InDeltaTime)
 {
 	if (GraphEditorPtr.IsValid())
 	{
 		GraphEditorPtr->ZoomToFit(false);
 	}
+	if (LitePanelPtr.IsValid())
+	{
+		LitePanelPtr->ZoomToFit();
+	}
 	return EActiveTimerReturnType::Stop;
 }
 
-void SRefExplorer::RebuildGraph()
+void SRefExplorer::RebuildGraph(bool bForceRelayout)
 {
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
 	if (AssetRegistryModule.Get().IsLoadingAssets())
@@ -1637,10 +6088,12 @@ void SRefExplorer::RebuildGraph()
 		// All assets are already discovered, build the graph now, if we have one
 		if (GraphObj)
 		{
-			GraphObj->RebuildGraph();
+			GraphObj->RebuildGraph(bForceRelayout);
 		}
 
 		bDirtyResults = false;
+		UpdateStatusText();
+
 		if (!AssetRefreshHandle.IsValid())
 		{
 			// Listen for updates
@@ -1657,6 +6110,12 @@ void SRefExplorer::OnNodeDoubleClicked(UEdGraphNode* Node)
 	{
 		if (UEdGraphNode_RefExplorer* RefExplorerNode = Cast<UEdGraphNode_RefExplorer>(Node))
 		{
+			if (RefExplorerNode->IsCluster())
+			{
+				GraphObj->ExpandCluster(RefExplorerNode);
+				return;
+			}
+
 			GraphObj->SetGraphRoot(RefExplorerNode->GetIdentifier());
 			GraphObj->RebuildGraph();
 
@@ -1666,15 +6125,33 @@ void SRefExplorer::OnNodeDoubleClicked(UEdGraphNode* Node)
 	}
 }
 
+void SRefExplorer::OnLiteNodeDoubleClicked(const FRefExplorerLiteNode& Node)
+{
+	if (GraphObj)
+	{
+		if (Node.NumClusterMembers > 0)
+		{
+			GraphObj->ExpandCluster(Node.Identifier, FIntPoint(FMath::RoundToInt(Node.Position.X), FMath::RoundToInt(Node.Position.Y)));
+			return;
+		}
+
+		GraphObj->SetGraphRoot(Node.Identifier);
+		GraphObj->RebuildGraph();
+
+		TriggerZoomToFit(0, 0);
+		RegisterActiveTimer(0.1f, FWidgetActiveTimerDelegate::CreateSP(this, &SRefExplorer::TriggerZoomToFit));
+	}
+}
+
 FActionMenuContent SRefExplorer::OnCreateGraphActionMenu(UEdGraph* InGraph, const FVector2D& InNodePosition, const TArray<UEdGraphPin*>& InDraggedPins, bool bAutoExpand, SGraphEditor::FActionMenuClosed InOnMenuClosed)
 {
 	// no context menu when not over a node
 	return FActionMenuContent();
 }
 
-void SRefExplorer::RefreshClicked()
+void SRefExplorer::RefreshClicked(bool bForceRelayout)
 {
-	RebuildGraph();
+	RebuildGraph(bForceRelayout);
 
 	TriggerZoomToFit(0, 0);
 	RegisterActiveTimer(0.1f, FWidgetActiveTimerDelegate::CreateSP(this, &SRefExplorer::TriggerZoomToFit));
@@ -1682,9 +6159,33 @@ void SRefExplorer::RefreshClicked()
 
 FText SRefExplorer::GetStatusText() const
 {
+	return StatusText;
+}
+
+void SRefExplorer::UpdateStatusText()
+{
+	StatusText = FText();
+
+	if (GraphObj && GraphObj->IsPopulating())
+	{
+		static const FNumberFormattingOptions SecondsFormat = FNumberFormattingOptions().SetMinimumFractionalDigits(1).SetMaximumFractionalDigits(1);
+		StatusText = FText::Format(LOCTEXT("PopulatingGraph", "Adding nodes {0} / {1}... {2} s"), FText::AsNumber(GraphObj->GetNumCreatedNodes()), FText::AsNumber(GraphObj->GetNumQueuedNodes()), FText::AsNumber(GraphObj->GetPopulateSeconds(), &SecondsFormat));
+		return;
+	}
+
+	if (const FRefExplorerUnsavedReferenceScanner* UnsavedReferenceScanner = GraphObj ? GraphObj->GetUnsavedReferenceScanner() : nullptr)
+	{
+		if (UnsavedReferenceScanner->IsScanning())
+		{
+			StatusText = FText::Format(LOCTEXT("ScanningUnsaved", "Scanning {0} edited package(s) for unsaved references..."), FText::AsNumber(UnsavedReferenceScanner->GetNumPendingPackages()));
+			return;
+		}
+	}
+
 	FString DirtyPackages;
 
-	if (GraphObj && GraphObj->CurrentGraphRootIdentifier.IsPackage())
+	// Unsaved references are overlaid when scanning, so saved ones are not stale
+	if (GraphObj && GraphObj->CurrentGraphRootIdentifier.IsPackage() && !GraphObj->IsShowingUnsavedReferences())
 	{
 		FString PackageString = GraphObj->CurrentGraphRootIdentifier.PackageName.ToString();
 		UPackage* InMemoryPackage = FindPackage(nullptr, *PackageString);
@@ -1696,15 +6197,21 @@ FText SRefExplorer::GetStatusText() const
 
 	if (DirtyPackages.Len() > 0)
 	{
-		return FText::Format(LOCTEXT("ModifiedWarning", "Showing old saved references for edited asset {0}"), FText::FromString(DirtyPackages));
+		StatusText = FText::Format(LOCTEXT("ModifiedWarning", "Showing old saved references for edited asset {0}"), FText::FromString(DirtyPackages));
 	}
-
-	if (bDirtyResults)
+	else if (bDirtyResults)
 	{
-		return LOCTEXT("DirtyWarning", "Saved references changed, refresh for update");
+		StatusText = LOCTEXT("DirtyWarning", "Saved references changed, refresh for update");
+	}
+	else if (GraphObj && GraphObj->IsLite())
+	{
+		StatusText = FText::Format(LOCTEXT("LiteGraph", "{0} nodes shown simplified, double-click a node to explore it"), FText::AsNumber(GraphObj->GetLiteGraph().Nodes.Num()));
+	}
+	else if (GraphObj && GraphObj->GetLastPopulateSeconds() > 0.0)
+	{
+		static const FNumberFormattingOptions SecondsFormat = FNumberFormattingOptions().SetMinimumFractionalDigits(1).SetMaximumFractionalDigits(1);
+		StatusText = FText::Format(LOCTEXT("PopulatedGraph", "Added {0} nodes in {1} s"), FText::AsNumber(GraphObj->GetNumCreatedNodes()), FText::AsNumber(GraphObj->GetLastPopulateSeconds(), &SecondsFormat));
 	}
-
-	return FText();
 }
 
 void SRefExplorer::RegisterActions()
@@ -1751,6 +6258,60 @@ void SRefExplorer::RegisterActions()
 		FRefExplorerCommands::Get().ShowReferenceTree,
 		FExecuteAction::CreateSP(this, &SRefExplorer::ShowReferenceTree),
 		FCanExecuteAction::CreateSP(this, &SRefExplorer::HasExactlyOnePackageNodeSelected));
+
+	RefExplorerActions->MapAction(
+		FRefExplorerCommands::Get().ReadPropertiesFromDisk,
+		FExecuteAction::CreateSP(this, &SRefExplorer::ToggleReadPropertiesFromDisk),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateSP(this, &SRefExplorer::IsReadingPropertiesFromDisk));
+
+	RefExplorerActions->MapAction(
+		FRefExplorerCommands::Get().ShowPropertyPins,
+		FExecuteAction::CreateSP(this, &SRefExplorer::ToggleShowPropertyPins),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateSP(this, &SRefExplorer::IsShowingPropertyPins));
+
+	RefExplorerActions->MapAction(
+		FRefExplorerCommands::Get().ShowUnsavedReferences,
+		FExecuteAction::CreateSP(this, &SRefExplorer::ToggleShowUnsavedReferences),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateSP(this, &SRefExplorer::IsShowingUnsavedReferences));
+
+	RefExplorerActions->MapAction(
+		FRefExplorerCommands::Get().RadialLayout,
+		FExecuteAction::CreateSP(this, &SRefExplorer::SetLayoutMode, FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode::Radial),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateSP(this, &SRefExplorer::IsLayoutMode, FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode::Radial));
+
+	RefExplorerActions->MapAction(
+		FRefExplorerCommands::Get().LayeredLayout,
+		FExecuteAction::CreateSP(this, &SRefExplorer::SetLayoutMode, FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode::Layered),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateSP(this, &SRefExplorer::IsLayoutMode, FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode::Layered));
+
+	RefExplorerActions->MapAction(
+		FRefExplorerCommands::Get().ForceDirectedLayout,
+		FExecuteAction::CreateSP(this, &SRefExplorer::SetLayoutMode, FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode::ForceDirected),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateSP(this, &SRefExplorer::IsLayoutMode, FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode::ForceDirected));
+
+	RefExplorerActions->MapAction(
+		FRefExplorerCommands::Get().ShowMinimap,
+		FExecuteAction::CreateSP(this, &SRefExplorer::ToggleShowMinimap),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateSP(this, &SRefExplorer::IsShowingMinimap));
+
+	RefExplorerActions->MapAction(
+		FRefExplorerCommands::Get().KeepNodePositions,
+		FExecuteAction::CreateSP(this, &SRefExplorer::ToggleKeepNodePositions),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateSP(this, &SRefExplorer::IsKeepingNodePositions));
+
+	RefExplorerActions->MapAction(
+		FRefExplorerCommands::Get().ClusterReferencers,
+		FExecuteAction::CreateSP(this, &SRefExplorer::ToggleClusterReferencers),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateSP(this, &SRefExplorer::IsClusteringReferencers));
 }
 
 void SRefExplorer::ShowSelectionInContentBrowser()
@@ -2050,8 +6611,26 @@ bool SRefExplorer::HasAtLeastOneRealNodeSelected() const
 
 void SRefExplorer::OnAssetRegistryChanged(const FAssetData& AssetData)
 {
+	// Properties of referencers are cached per package, links are only picked up by a refresh
+	if (GraphObj)
+	{
+		GraphObj->InvalidateRefPropInfos({ AssetData.PackageName }, true);
+	}
+
 	// We don't do more specific checking because that data is not exposed, and it wouldn't handle newly added references anyway
-	bDirtyResults = true;
+	if (!bDirtyResults)
+	{
+		bDirtyResults = true;
+		UpdateStatusText();
+	}
+}
+
+void SRefExplorer::OnPackageDirtyStateChanged(UPackage* Package)
+{
+	if (Package && GraphObj && Package->GetFName() == GraphObj->CurrentGraphRootIdentifier.PackageName)
+	{
+		UpdateStatusText();
+	}
 }
 
 void SRefExplorer::OnInitialAssetRegistrySearchComplete()
@@ -2067,7 +6646,11 @@ void SRefExplorer::OnInitialAssetRegistrySearchComplete()
 
 void SRefExplorer::ZoomToFit()
 {
-	if (GraphEditorPtr.IsValid())
+	if (LitePanelPtr.IsValid() && GraphObj && GraphObj->IsLite())
+	{
+		LitePanelPtr->ZoomToFit();
+	}
+	else if (GraphEditorPtr.IsValid())
 	{
 		GraphEditorPtr->ZoomToFit(true);
 	}
@@ -2083,9 +6666,161 @@ bool SRefExplorer::CanZoomToFit() const
 	return false;
 }
 
+void SRefExplorer::ToggleReadPropertiesFromDisk()
+{
+	if (GraphObj)
+	{
+		GraphObj->SetReadPropertiesFromDisk(!GraphObj->IsReadingPropertiesFromDisk());
+		RefreshClicked();
+	}
+}
+
+bool SRefExplorer::IsReadingPropertiesFromDisk() const
+{
+	return GraphObj && GraphObj->IsReadingPropertiesFromDisk();
+}
+
+void SRefExplorer::ToggleShowPropertyPins()
+{
+	if (GraphObj)
+	{
+		GraphObj->SetShowPropertyPins(!GraphObj->IsShowingPropertyPins());
+		RefreshClicked();
+	}
+}
+
+bool SRefExplorer::IsShowingPropertyPins() const
+{
+	return GraphObj && GraphObj->IsShowingPropertyPins();
+}
+
+void SRefExplorer::ToggleShowUnsavedReferences()
+{
+	if (GraphObj)
+	{
+		GraphObj->SetShowUnsavedReferences(!GraphObj->IsShowingUnsavedReferences());
+		RefreshClicked();
+	}
+}
+
+bool SRefExplorer::IsShowingUnsavedReferences() const
+{
+	return GraphObj && GraphObj->IsShowingUnsavedReferences();
+}
+
+void SRefExplorer::SetLayoutMode(FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode LayoutMode)
+{
+	if (GraphObj && GraphObj->GetLayoutMode() != LayoutMode)
+	{
+		GraphObj->SetLayoutMode(LayoutMode);
+
+		// Picking a layout asks for a full relayout
+		RefreshClicked(true);
+	}
+}
+
+void SRefExplorer::ToggleKeepNodePositions()
+{
+	if (GraphObj)
+	{
+		GraphObj->SetKeepNodePositions(!GraphObj->IsKeepingNodePositions());
+	}
+}
+
+bool SRefExplorer::IsKeepingNodePositions() const
+{
+	return GraphObj && GraphObj->IsKeepingNodePositions();
+}
+
+void SRefExplorer::ToggleClusterReferencers()
+{
+	if (GraphObj)
+	{
+		GraphObj->SetClusterReferencers(!GraphObj->IsClusteringReferencers());
+		RefreshClicked();
+	}
+}
+
+bool SRefExplorer::IsClusteringReferencers() const
+{
+	return GraphObj && GraphObj->IsClusteringReferencers();
+}
+
+void SRefExplorer::ToggleShowMinimap()
+{
+	bShowMinimap = !bShowMinimap;
+}
+
+bool SRefExplorer::IsShowingMinimap() const
+{
+	return bShowMinimap;
+}
+
+FBox2D SRefExplorer::GetViewRect() const
+{
+	if (LitePanelPtr.IsValid() && GraphObj && GraphObj->IsLite())
+	{
+		return LitePanelPtr->GetViewRect();
+	}
+
+	if (!GraphEditorPtr.IsValid())
+	{
+		return FBox2D(ForceInit);
+	}
+
+	FVector2D ViewLocation;
+	float ZoomAmount = 1.f;
+	GraphEditorPtr->GetViewLocation(ViewLocation, ZoomAmount);
+
+	return FBox2D(ViewLocation, ViewLocation + GraphEditorPtr->GetTickSpaceGeometry().GetLocalSize() / ZoomAmount);
+}
+
+void SRefExplorer::JumpTo(const FVector2D& GraphLocation)
+{
+	if (LitePanelPtr.IsValid() && GraphObj && GraphObj->IsLite())
+	{
+		LitePanelPtr->CenterOn(GraphLocation);
+	}
+	else if (GraphEditorPtr.IsValid())
+	{
+		FVector2D ViewLocation;
+		float ZoomAmount = 1.f;
+		GraphEditorPtr->GetViewLocation(ViewLocation, ZoomAmount);
+
+		GraphEditorPtr->SetViewLocation(GraphLocation - GraphEditorPtr->GetTickSpaceGeometry().GetLocalSize() * 0.5f / ZoomAmount, ZoomAmount);
+	}
+}
+
+bool SRefExplorer::IsLayoutMode(FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode LayoutMode) const
+{
+	return GraphObj && GraphObj->GetLayoutMode() == LayoutMode;
+}
+
 TSharedRef<SWidget> SRefExplorer::GetShowMenuContent()
 {
 	FMenuBuilder MenuBuilder(true, RefExplorerActions);
+
+	MenuBuilder.BeginSection("Properties", LOCTEXT("PropertiesSection", "Properties"));
+	MenuBuilder.AddMenuEntry(FRefExplorerCommands::Get().ReadPropertiesFromDisk);
+	MenuBuilder.AddMenuEntry(FRefExplorerCommands::Get().ShowPropertyPins);
+	MenuBuilder.EndSection();
+
+	MenuBuilder.BeginSection("References", LOCTEXT("ReferencesSection", "References"));
+	MenuBuilder.AddMenuEntry(FRefExplorerCommands::Get().ShowUnsavedReferences);
+	MenuBuilder.AddMenuEntry(FRefExplorerCommands::Get().ClusterReferencers);
+	MenuBuilder.EndSection();
+
+	MenuBuilder.BeginSection("Layout", LOCTEXT("LayoutSection", "Layout"));
+	MenuBuilder.AddMenuEntry(FRefExplorerCommands::Get().RadialLayout);
+	MenuBuilder.AddMenuEntry(FRefExplorerCommands::Get().LayeredLayout);
+	MenuBuilder.AddMenuEntry(FRefExplorerCommands::Get().ForceDirectedLayout);
+	MenuBuilder.AddMenuEntry(FRefExplorerCommands::Get().KeepNodePositions);
+	MenuBuilder.EndSection();
+
+	MenuBuilder.BeginSection("View", LOCTEXT("ViewSection", "View"));
+	MenuBuilder.AddMenuEntry(FRefExplorerCommands::Get().ShowMinimap);
+	MenuBuilder.EndSection();
+
 	return MenuBuilder.MakeWidget();
 }
 
@@ -2188,6 +6923,14 @@ TSharedRef<SWidget> SRefExplorer::MakeToolBar()
 
 	//////ToolBarBuilder.EndSection();
 
+	ToolBarBuilder.AddComboButton(
+		FUIAction(),
+		FOnGetContent::CreateSP(this, &SRefExplorer::GetShowMenuContent),
+		TAttribute<FText>(),
+		LOCTEXT("ShowMenuTooltip", "Ref Explorer options"),
+		FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Settings"),
+		/*bInSimpleComboBox*/ false);
+
 	return ToolBarBuilder.MakeWidget();
 }
 
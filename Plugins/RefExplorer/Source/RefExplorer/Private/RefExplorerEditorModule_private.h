@@ -5,11 +5,43 @@
 #include "EdGraph/EdGraphSchema.h"
 #include "Misc/AssetRegistryInterface.h"
 #include "EdGraphUtilities.h"
+#include "Containers/Ticker.h"
+#include "Containers/LruCache.h"
+#include "UObject/ObjectSaveContext.h"
+#include <atomic>
 #include "RefExplorerEditorModule_private.generated.h"
 
 namespace FRefExplorerEditorModule_PRIVATE
 {
 	enum class EDependencyPinCategory;
+
+	enum class ERefExplorerLayoutMode : uint8
+	{
+		Radial,
+		Layered,
+		ForceDirected,
+	};
+
+	/** How much of a node is drawn, from the zoom level of the graph panel */
+	enum class ERefExplorerDetailLevel : uint8
+	{
+		Placeholder,
+		Summary,
+		Title,
+		Full,
+	};
+
+	struct FRefPropInfo
+	{
+		FString Name;
+		FString Category;
+		bool IsSoft;
+
+		FRefPropInfo(const FString& name, const FString& category = "", const bool isSoft = false) : Name(name), Category(category), IsSoft(isSoft) {}
+
+		/** Gets property of the owner that holds the reference, e.g. Components for Components[3].StaticMesh */
+		FString GetTopLevelName() const;
+	};
 }
 
 class UToolMenu;
@@ -18,6 +50,13 @@ class FConnectionDrawingPolicy;
 class FSlateWindowElementList;
 class UEdGraph;
 class FAssetThumbnailPool;
+class FAssetThumbnail;
+class UBlueprint;
+class UEdGraphNode_RefExplorer;
+class SGraphNode_RefExplorer;
+class SRefExplorerLitePanel;
+class SRefExplorerMinimap;
+struct FRefExplorerLiteNode;
 
 //------------------------------------------------------
 // FRefExplorerGraphNodeFactory
@@ -54,25 +93,47 @@ public:
 	/** Gets graph editor */
 	TSharedPtr<SGraphEditor> GetGraphEditor() const { return GraphEditorPtr; }
 
+	/** Updates the warning/status text, called when anything it shows changes instead of polling every frame */
+	void UpdateStatusText();
+
 	/**SWidget interface **/
 	virtual bool SupportsKeyboardFocus() const override { return true; }
 	virtual FReply OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
 
 private:
-	void RebuildGraph();
+	void RebuildGraph(bool bForceRelayout = false);
 
 	void OnNodeDoubleClicked(UEdGraphNode* Node);
 
 	FActionMenuContent OnCreateGraphActionMenu(UEdGraph* InGraph, const FVector2D& InNodePosition, const TArray<UEdGraphPin*>& InDraggedPins, bool bAutoExpand, SGraphEditor::FActionMenuClosed InOnMenuClosed);
 
 	/** Refresh the current view */
-	void RefreshClicked();
+	void RefreshClicked(bool bForceRelayout = false);
 
 	/** Gets the text to be displayed for warning/status updates */
 	FText GetStatusText() const;
 
 	TSharedRef<SWidget> GetShowMenuContent();
 
+	void ToggleReadPropertiesFromDisk();
+	bool IsReadingPropertiesFromDisk() const;
+	void ToggleShowPropertyPins();
+	bool IsShowingPropertyPins() const;
+	void ToggleShowUnsavedReferences();
+	bool IsShowingUnsavedReferences() const;
+	void SetLayoutMode(FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode LayoutMode);
+	bool IsLayoutMode(FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode LayoutMode) const;
+	void ToggleKeepNodePositions();
+	bool IsKeepingNodePositions() const;
+	void ToggleClusterReferencers();
+	bool IsClusteringReferencers() const;
+	void ToggleShowMinimap();
+	bool IsShowingMinimap() const;
+
+	/** Gets the part of the graph in view and moves the view, for the minimap */
+	FBox2D GetViewRect() const;
+	void JumpTo(const FVector2D& GraphLocation);
+
 	void RegisterActions();
 	void ShowSelectionInContentBrowser();
 	void OpenSelectedInAssetEditor();
@@ -102,14 +163,23 @@ private:
 	bool HasAtLeastOneRealNodeSelected() const;
 
 	void OnAssetRegistryChanged(const FAssetData& AssetData);
+	void OnPackageDirtyStateChanged(UPackage* Package);
 	void OnInitialAssetRegistrySearchComplete();
 	EActiveTimerReturnType TriggerZoomToFit(double InCurrentTime, float InDeltaTime);
 
+	/** Turns node widgets far out of view back into placeholders, so built widgets scale with the view and not the graph */
+	EActiveTimerReturnType ReleaseOffscreenNodeWidgets(double InCurrentTime, float InDeltaTime);
+
+	void OnLiteNodeDoubleClicked(const FRefExplorerLiteNode& Node);
+
 private:
 	TSharedRef<SWidget> MakeToolBar();
 
 	TSharedPtr<SGraphEditor> GraphEditorPtr;
 
+	/** Shown instead of the graph editor for graphs too large for graph nodes */
+	TSharedPtr<SRefExplorerLitePanel> LitePanelPtr;
+
 	TSharedPtr<FUICommandList> RefExplorerActions;
 
 	UEdGraph_RefExplorer* GraphObj;
@@ -117,8 +187,14 @@ private:
 	/** True if our view is out of date due to asset registry changes */
 	bool bDirtyResults;
 
+	bool bShowMinimap;
+
 	/** Handle to know if dirty */
 	FDelegateHandle AssetRefreshHandle;
+
+	FDelegateHandle PackageDirtyStateChangedHandle;
+
+	FText StatusText;
 };
 
 //--------------------------------------------------------------------
@@ -149,6 +225,18 @@ public:
 // FRefExplorerNodeInfo
 //--------------------------------------------------------------------
 
+/** Node waiting to be created under its parent, queued breadth first while the graph is populated */
+struct FRefExplorerNodeBuildItem
+{
+	FAssetIdentifier AssetId;
+
+	FAssetIdentifier ParentId;
+
+	FIntPoint NodeLoc;
+
+	FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory Category;
+};
+
 struct FRefExplorerNodeInfo
 {
 	FAssetIdentifier AssetId;
@@ -159,9 +247,76 @@ struct FRefExplorerNodeInfo
 
 	TSet<FAssetIdentifier> Parents;
 
+	/** Referencers aggregated into this node, if it is a folder cluster */
+	TArray<FAssetIdentifier> ClusterMembers;
+
 	FRefExplorerNodeInfo(const FAssetIdentifier& InAssetId) :AssetId(InAssetId) {};
 };
 
+/** Nodes in the same top level folder, drawn as a single summary glyph when zoomed out */
+struct FRefExplorerNodeAggregate
+{
+	FString Path;
+
+	TArray<UEdGraphNode_RefExplorer*> Members;
+
+	/** Member closest to the center of the aggregate, draws the summary */
+	UEdGraphNode_RefExplorer* Representative = nullptr;
+
+	/** Where wires of the members to the root merge into a bundle, in graph space */
+	FVector2D BundleLocation = FVector2D::ZeroVector;
+
+	/** Tessellated wires of the members to BundleLocation in member order, then the trunk to the root, in graph space */
+	TArray<FVector2D> BundlePoints;
+};
+
+//--------------------------------------------------------------------
+// FRefExplorerLiteGraph
+//--------------------------------------------------------------------
+
+struct FRefExplorerLiteNode
+{
+	FAssetIdentifier Identifier;
+
+	FText Label;
+
+	FLinearColor Color;
+
+	/** Top left corner, in graph space */
+	FVector2D Position = FVector2D::ZeroVector;
+
+	/** Referencers aggregated into this node, if it is a folder cluster */
+	int32 NumClusterMembers = 0;
+};
+
+struct FRefExplorerLiteEdge
+{
+	int32 Referencer;
+	int32 Referenced;
+
+	FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory Category;
+};
+
+/** Plain nodes and edges of graphs too large for graph node objects, drawn by SRefExplorerLitePanel */
+struct FRefExplorerLiteGraph
+{
+	TArray<FRefExplorerLiteNode> Nodes;
+	TArray<FRefExplorerLiteEdge> Edges;
+
+	/** Bounds of all nodes, valid once laid out */
+	FBox2D Bounds = FBox2D(ForceInit);
+
+	/** Incremented whenever nodes are laid out, so the panel knows to zoom to fit */
+	uint32 LayoutSerial = 0;
+
+	FORCEINLINE bool IsEmpty() const { return Nodes.IsEmpty(); }
+
+	void Reset();
+
+	/** Gets index of the node under the location, in graph space, INDEX_NONE if there is none */
+	int32 FindNodeAt(const FVector2D& Location) const;
+};
+
 //--------------------------------------------------------------------
 // UEdGraphNode_RefExplorer
 //--------------------------------------------------------------------
@@ -187,14 +342,44 @@ class UEdGraphNode_RefExplorer : public UEdGraphNode
 	FORCEINLINE bool UsesThumbnail() const { return bUsesThumbnail; }
 	FORCEINLINE bool IsPackage() const { return bIsPackage; }
 
+	/** Cluster nodes stand for all referencers in a content folder or mount point */
+	FORCEINLINE bool IsCluster() const { return NumClusterMembers > 0; }
+	FORCEINLINE FString GetClusterPath() const { return Identifier.PackageName.ToString(); }
+
+	/** Index of the folder aggregate the node belongs to, INDEX_NONE if it is always drawn on its own */
+	FORCEINLINE int32 GetAggregateIndex() const { return AggregateIndex; }
+	FORCEINLINE int32 GetAggregateMemberIndex() const { return AggregateMemberIndex; }
+
 	FORCEINLINE FAssetData GetAssetData() const { return CachedAssetData; }
 
 	FORCEINLINE UEdGraphPin* GetDependencyPin() { return DependencyPin; }
 	FORCEINLINE UEdGraphPin* GetReferencerPin() { return ReferencerPin; }
 
+	FORCEINLINE bool HasPropertyPins() const { return !PropertyPins.IsEmpty(); }
+
+	/** Size of the node's widget when it was last drawn with full detail, zero until then */
+	FORCEINLINE const FVector2D& GetFullDetailSize() const { return FullDetailSize; }
+	FORCEINLINE void SetFullDetailSize(const FVector2D& InFullDetailSize) { FullDetailSize = InFullDetailSize; }
+
+	/** Gets the category the pin was created with, without parsing its name */
+	FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory GetPinCategory(const UEdGraphPin* Pin) const;
+
+	/** Gets thickness of wires going out of the pin, property pins get thicker the more references they hold */
+	float GetWireThickness(const UEdGraphPin* Pin, float DefaultThickness) const;
+
 private:
 	void SetupRefExplorerNode(const FIntPoint& NodeLoc, const FAssetIdentifier& NewIdentifier, const FAssetData& InAssetData);
+	void SetupClusterNode(const FIntPoint& NodeLoc, const FAssetIdentifier& NewIdentifier, int32 InNumClusterMembers);
 	void AddReferencer(UEdGraphNode_RefExplorer* ReferencerNode);
+	void AddReferencer(UEdGraphPin* ReferencerDependencyPin);
+	void SetDependencyPinCategory(FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory Category);
+
+	/** Shows the node as a level, for packages without asset data found to be maps */
+	void SetMapPackage();
+
+	/** Replaces the dependency pin with a pin per referencing property, each wired to the root */
+	void SetupPropertyPins(const TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo>& RefPropInfos, UEdGraphNode_RefExplorer* RootNode);
+	void RemovePropertyPins();
 
 protected:
 	FAssetIdentifier Identifier;
@@ -204,6 +389,12 @@ protected:
 	bool bIsPackage;
 	bool bIsPrimaryAsset;
 
+	int32 NumClusterMembers;
+	int32 AggregateIndex;
+	int32 AggregateMemberIndex;
+
+	FVector2D FullDetailSize;
+
 	FAssetData CachedAssetData;
 	FLinearColor AssetTypeColor;
 	FSlateIcon AssetBrush;
@@ -211,9 +402,134 @@ protected:
 	UEdGraphPin* DependencyPin;
 	UEdGraphPin* ReferencerPin;
 
+	TArray<UEdGraphPin*> PropertyPins;
+	TMap<const UEdGraphPin*, int32> PropertyPinReferenceCounts;
+
+	/** Categories of pins as set up, pin category names are only kept for the schema */
+	FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory DependencyPinCategory;
+	TMap<const UEdGraphPin*, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory> PropertyPinCategories;
+
 	friend UEdGraph_RefExplorer;
 };
 
+//--------------------------------------------------------------------
+// FRefExplorerSpatialIndex
+//--------------------------------------------------------------------
+
+/** Uniform grid of node rectangles, for finding free space and nodes in an area without touching every node */
+class FRefExplorerSpatialIndex
+{
+public:
+	explicit FRefExplorerSpatialIndex(float InCellSize = 256.f) : CellSize(InCellSize) {}
+
+	void Reset();
+
+	/** Adds a rectangle and returns its index */
+	int32 Add(const FBox2D& Bounds);
+
+	FORCEINLINE int32 Num() const { return Items.Num(); }
+
+	/** Gets indices of rectangles that overlap the bounds */
+	void Query(const FBox2D& Bounds, TArray<int32>& OutIndices) const;
+
+	bool Overlaps(const FBox2D& Bounds) const;
+
+	/** Finds the closest location to the desired one, stepping by the step or the size, where a rectangle of the size overlaps nothing */
+	FVector2D FindFreeLocation(const FVector2D& DesiredLocation, const FVector2D& Size, const FVector2D& Step = FVector2D::ZeroVector) const;
+
+private:
+	FIntPoint GetCell(const FVector2D& Location) const;
+
+	float CellSize;
+
+	TArray<FBox2D> Items;
+
+	TMap<FIntPoint, TArray<int32>> Cells;
+};
+
+//--------------------------------------------------------------------
+// FRefExplorerUnsavedReferenceScanner
+//--------------------------------------------------------------------
+
+/** Collects package references of dirty packages from memory, a few objects per frame, so edges show up before packages are saved */
+class FRefExplorerUnsavedReferenceScanner
+{
+public:
+	/** Called with the dirty package and the package names it started or stopped referencing */
+	DECLARE_DELEGATE_TwoParams(FOnUnsavedReferencesChanged, FName, const TSet<FName>&);
+
+	FRefExplorerUnsavedReferenceScanner();
+	~FRefExplorerUnsavedReferenceScanner();
+
+	FORCEINLINE const TMap<FName, TSet<FName>>& GetUnsavedReferences() const { return UnsavedReferences; }
+
+	FORCEINLINE bool IsScanning() const { return ScanningPackage.IsValid() || !PendingPackageNames.IsEmpty(); }
+	FORCEINLINE int32 GetNumPendingPackages() const { return PendingPackageNames.Num() + (ScanningPackage.IsValid() ? 1 : 0); }
+
+	FOnUnsavedReferencesChanged OnUnsavedReferencesChanged;
+
+	/** Called when packages are queued or done scanning */
+	FSimpleDelegate OnScanningChanged;
+
+private:
+	void OnPackageMarkedDirty(UPackage* Package, bool bWasDirty);
+	void OnPackageDirtyStateChanged(UPackage* Package);
+
+	void EnqueuePackage(UPackage* Package);
+	bool StartNextPackage();
+	void FinishPackage();
+
+	bool Tick(float DeltaTime);
+
+	/** In-memory references of dirty packages, dropped once a package is saved or reverted */
+	TMap<FName, TSet<FName>> UnsavedReferences;
+
+	/** Packages waiting to be scanned, consumed from PendingPackageHead. Only the ones still in PendingPackageNames are scanned */
+	TArray<TWeakObjectPtr<UPackage>> PendingPackages;
+	int32 PendingPackageHead;
+	TSet<FName> PendingPackageNames;
+
+	TWeakObjectPtr<UPackage> ScanningPackage;
+
+	/** Set when the package being scanned is edited again, it is queued once more when done */
+	bool bRescanScanningPackage;
+	TArray<TWeakObjectPtr<UObject>> ScanningObjects;
+	int32 ScanningObjectIdx;
+	TSet<FName> ScanningReferences;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle PackageMarkedDirtyHandle;
+	FDelegateHandle PackageDirtyStateChangedHandle;
+};
+
+//--------------------------------------------------------------------
+// FRefExplorerThumbnailCache
+//--------------------------------------------------------------------
+
+/** Thumbnails shared by all explorers, recently used ones are kept within a memory budget and the rest are released least recent first */
+class FRefExplorerThumbnailCache
+{
+public:
+	/** Gets the cache of the open explorers, it goes away with the last of them */
+	static TSharedRef<FRefExplorerThumbnailCache> Get();
+
+	FRefExplorerThumbnailCache();
+
+	/** Gets the thumbnail of the asset at the resolution, rendering it if it is not cached */
+	TSharedRef<FAssetThumbnail> FindOrCreate(const FAssetData& AssetData, uint32 Resolution);
+
+	/** Renders the thumbnails before any other waiting ones, e.g. for nodes in view */
+	void Prioritize(const TArray<TSharedPtr<FAssetThumbnail>>& Thumbnails);
+
+private:
+	typedef TPair<FSoftObjectPath, uint32> FThumbnailKey;
+
+	TSharedPtr<FAssetThumbnailPool> Pool;
+
+	TLruCache<FThumbnailKey, TSharedPtr<FAssetThumbnail>> Thumbnails;
+	SIZE_T UsedBytes;
+};
+
 //--------------------------------------------------------------------
 // UEdGraph_RefExplorer
 //--------------------------------------------------------------------
@@ -231,13 +547,83 @@ public:
 	/** Set Ref Explorer to focus on these assets */
 	void SetGraphRoot(const FAssetIdentifier& GraphRootIdentifier, const FIntPoint& GraphRootOrigin = FIntPoint(ForceInitToZero));
 
-	/** Accessor for the thumbnail pool in this graph */
-	const TSharedPtr<FAssetThumbnailPool>& GetAssetThumbnailPool() const;
+	FORCEINLINE FRefExplorerThumbnailCache& GetThumbnailCache() const { return *ThumbnailCache; }
 
-	/** Force the graph to rebuild */
-	UEdGraphNode_RefExplorer* RebuildGraph();
+	/** Force the graph to rebuild, bForceRelayout ignores the positions nodes have now */
+	UEdGraphNode_RefExplorer* RebuildGraph(bool bForceRelayout = false);
 
 	const FRefExplorerNodeInfo& GetGraphRootNodeInfo() const { return RefExplorerNodeInfos[CurrentGraphRootIdentifier]; }
+	FORCEINLINE const FAssetIdentifier& GetGraphRootIdentifier() const { return CurrentGraphRootIdentifier; }
+
+	/** Large graphs are populated over several frames, nodes show up as they are created */
+	FORCEINLINE bool IsPopulating() const { return PopulateTickerHandle.IsValid(); }
+	FORCEINLINE int32 GetNumCreatedNodes() const { return NodeBuildQueueHead; }
+	FORCEINLINE int32 GetNumQueuedNodes() const { return NodeBuildQueue.Num(); }
+	FORCEINLINE double GetPopulateSeconds() const { return FPlatformTime::Seconds() - PopulateStartTime; }
+
+	/** Time the last population over several frames took, zero until one completes for the shown graph */
+	FORCEINLINE double GetLastPopulateSeconds() const { return LastPopulateSeconds; }
+
+	/** If true, referencing properties are read from package files on worker threads and referencers are never loaded */
+	FORCEINLINE bool IsReadingPropertiesFromDisk() const { return bReadPropertiesFromDisk; }
+	void SetReadPropertiesFromDisk(bool bInReadPropertiesFromDisk);
+
+	/** If true, every referencing property of a root referencer gets its own pin wired to the root */
+	FORCEINLINE bool IsShowingPropertyPins() const { return bShowPropertyPins; }
+	FORCEINLINE void SetShowPropertyPins(bool bInShowPropertyPins) { bShowPropertyPins = bInShowPropertyPins; }
+
+	/** If true, references of dirty packages are scanned in memory and overlaid on the saved ones */
+	FORCEINLINE bool IsShowingUnsavedReferences() const { return UnsavedReferenceScanner.IsValid(); }
+	void SetShowUnsavedReferences(bool bInShowUnsavedReferences);
+
+	FORCEINLINE const FRefExplorerUnsavedReferenceScanner* GetUnsavedReferenceScanner() const { return UnsavedReferenceScanner.Get(); }
+
+	FORCEINLINE FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode GetLayoutMode() const { return LayoutMode; }
+	FORCEINLINE void SetLayoutMode(FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode InLayoutMode) { LayoutMode = InLayoutMode; }
+
+	/** Gets nodes which bounds overlap the rect, in graph space */
+	void FindNodesInRect(const FBox2D& Rect, TArray<UEdGraphNode_RefExplorer*>& OutNodes);
+
+	/** Bounds changed outside of layout, e.g. a node was dragged, the index is rebuilt on next query */
+	FORCEINLINE void MarkSpatialIndexDirty() { bSpatialIndexDirty = true; LayoutVersion++; }
+
+	/** Changes whenever nodes are added, removed or moved, by layout or by the user */
+	FORCEINLINE uint32 GetLayoutVersion() const { return LayoutVersion; }
+
+	/** Gets bounds and colors of all nodes in graph space, of graph nodes or of the lite graph */
+	void GetNodeRects(TArray<TPair<FBox2D, FLinearColor>>& OutNodeRects) const;
+
+	/** Nodes were moved by the user, positions are written to the layout cache before the graph goes away */
+	FORCEINLINE void MarkLayoutCacheDirty() { bLayoutCacheDirty = true; }
+	void FlushLayoutCache();
+
+	/** Graphs with too many nodes are built as a lite graph only, without graph nodes */
+	FORCEINLINE bool IsLite() const { return !LiteGraph.IsEmpty(); }
+	FORCEINLINE const FRefExplorerLiteGraph& GetLiteGraph() const { return LiteGraph; }
+
+	/** Node widgets build their content once they are first painted and register here to be released later */
+	void AddRealizedNodeWidget(const TSharedRef<SGraphNode_RefExplorer>& NodeWidget);
+
+	/** Gets a widget for the node, rebinding a pooled widget no panel shows anymore if there is one */
+	TSharedRef<SGraphNode_RefExplorer> AcquireNodeWidget(UEdGraphNode_RefExplorer* Node);
+
+	/** Gets the folder aggregate of the node for drawing it zoomed out, nullptr if the node is not aggregated */
+	const FRefExplorerNodeAggregate* GetNodeAggregate(const UEdGraphNode_RefExplorer* Node);
+
+	/** If true, referencers of roots with many referencers are grouped by content folder or mount point */
+	FORCEINLINE bool IsClusteringReferencers() const { return bClusterReferencers; }
+	FORCEINLINE void SetClusterReferencers(bool bInClusterReferencers) { bClusterReferencers = bInClusterReferencers; }
+
+	/** Replaces the cluster with its subfolders and the referencers directly in its folder */
+	void ExpandCluster(UEdGraphNode_RefExplorer* ClusterNode);
+	void ExpandCluster(const FAssetIdentifier& ClusterIdentifier, const FIntPoint& ClusterLoc);
+
+	/** If true, rebuilding the same root keeps nodes where they are and only places new ones */
+	FORCEINLINE bool IsKeepingNodePositions() const { return bKeepNodePositions; }
+	FORCEINLINE void SetKeepNodePositions(bool bInKeepNodePositions) { bKeepNodePositions = bInKeepNodePositions; }
+
+	/** Gets full paths of referencer properties that reference the root, scanned once per root and cached */
+	const TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo>& GetRefPropInfos(const UEdGraphNode_RefExplorer* ReferencerNode);
 
 private:
 	FORCEINLINE void SetRefExplorer(TSharedPtr<SRefExplorer> InRefExplorer) { RefExplorer = InRefExplorer; }
@@ -245,24 +631,105 @@ private:
 	/* Searches for the AssetData for the list of packages derived from the AssetReferences  */
 	void GatherAssetData(TMap<FAssetIdentifier, FRefExplorerNodeInfo>& InNodeInfos);
 
-	/* Uses the NodeInfos map to generate and layout the graph nodes */
-	UEdGraphNode_RefExplorer* RecursivelyCreateNodes(
-		const FAssetIdentifier& InAssetId,
-		const FIntPoint& InNodeLoc,
-		const FAssetIdentifier& InParentId,
-		UEdGraphNode_RefExplorer* InParentNode,
-		TMap<FAssetIdentifier, FRefExplorerNodeInfo>& InNodeInfos,
-		bool bIsRoot = false
-	);
+	/* Queues children of the root node, nodes are then created breadth first from the node infos */
+	void BeginCreateNodes(UEdGraphNode_RefExplorer* RootNode);
+
+	/* Creates up to MaxNodes queued nodes, each asset gets one node and is wired to all its parents. Returns true once the queue is empty */
+	bool CreateQueuedNodes(int32 MaxNodes = MAX_int32);
+
+	/** Creates queued nodes within the frame budget, then lays the graph out once all of them exist */
+	bool TickPopulate(float DeltaTime);
+	void StopPopulating();
+
+	/** Places the created nodes and adds what depends on all of them being there */
+	void FinishCreateNodes(const TMap<FAssetIdentifier, FIntPoint>& PreviousPositions);
+
+	/* Queues children of the node, placed on an arc to the left of it */
+	void QueueChildNodes(const FAssetIdentifier& InAssetId, const FIntPoint& InNodeLoc);
 
 	/** Removes all nodes from the graph */
 	void RemoveAllNodes();
 
+	/** Computes positions of all nodes on a worker thread with the current layout mode */
+	void LayoutGraph();
+
+	/** Stops the layout job in flight, if any */
+	void CancelLayout();
+
+	/** Restores positions of nodes that were in the graph before and puts new nodes into free space near their parents */
+	void PlaceNodesIncrementally(const TMap<FAssetIdentifier, FIntPoint>& PreviousPositions);
+
+	/** Layouts are cached on disk per root and layout mode, and are only used for the same set of nodes. Files are read and written on worker threads */
+	void UpdateLayoutCacheKey();
+	void LoadLayoutCache();
+	void SaveLayoutCache();
+
+	/** Places nodes at the positions read from the cache, or lays them out if the cache does not have all of them */
+	void OnLayoutCacheLoaded(const TMap<FString, FIntPoint>& CachedPositions);
+
+	/** Moves nodes to computed positions, relative to the root origin */
+	void ApplyLayout(const TArray<FAssetIdentifier>& LayoutIdentifiers, const TArray<FVector2D>& Positions, bool bZoomToFit, bool bRemoveOverlaps);
+
+	/** Zooms the explorer to nodes that got their positions after it zoomed already */
+	void ZoomExplorerToFit() const;
+
+	/** Gets size of the node widget with full detail, or an estimate if it was not drawn with full detail yet */
+	FVector2D GetNodeSize(const UEdGraphNode_RefExplorer* Node) const;
+
+	/** Moves nodes that overlap nodes closer to the root into the nearest free space, and rebuilds the spatial index */
+	void RemoveNodeOverlaps();
+
+	/** Rebuilds the spatial index from current node positions */
+	void UpdateSpatialIndex();
+
+	/** Groups nodes by top level folder, once per rebuild from package names only */
+	void BuildNodeAggregates();
+	void UpdateAggregateRepresentatives();
+
+	/** Reads referencing properties of all referencers from their package files on worker threads */
+	void GatherRefPropInfosFromDisk();
+
+	/** Sets up property pins of root referencers, referencers that have to be loaded first are queued for TickPropertyPins */
+	void CreatePropertyPins();
+
+	/** Loads queued referencers within the frame budget and sets up their property pins */
+	bool TickPropertyPins(float DeltaTime);
+	void StopPropertyPins();
+
+	/** Gets whether the package is a map from registry package data or earlier checks. Returns false and queues a check on disk if neither knows */
+	bool FindIsMapPackage(FName PackageName, bool& bOutIsMapPackage);
+
+	/** Checks queued packages for map files on a worker thread and updates their nodes */
+	void CheckPendingMapPackages();
+
+	/** Builds the lite graph from the node infos and lays it out on a worker thread */
+	void BuildLiteGraph();
+
 	void GetSortedLinks(const FAssetIdentifier& GraphRootIdentifier, TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& OutLinks) const;
 
+	/** Replaces links in collapsed folders with a link to a cluster per folder, from package names only */
+	void ClusterLinks(TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& InOutLinks, TMap<FAssetIdentifier, TArray<FAssetIdentifier>>& OutClusterMembers) const;
+
+	/** Adds links of dirty packages that reference the root in memory only and marks links that are gone in memory */
+	void AddUnsavedLinks(const FAssetIdentifier& GraphRootIdentifier, TMap<FAssetIdentifier, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory>& OutLinks) const;
+
+	void OnUnsavedReferencesChanged(FName PackageName, const TSet<FName>& ChangedReferences);
+
+	/** Lets the explorer update its status text */
+	void NotifyStatusChanged() const;
+
+	void OnBlueprintPreCompile(UBlueprint* Blueprint);
+	void OnBlueprintCompiled();
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+
+	/** Drops cached referencing properties that involve any of the packages and refreshes only the affected nodes, bFilesChanged also drops properties read from disk */
+	void InvalidateRefPropInfos(const TSet<FName>& PackageNames, bool bFilesChanged = false);
+
 private:
-	/** Pool for maintaining and rendering thumbnails */
-	TSharedPtr<FAssetThumbnailPool> AssetThumbnailPool;
+	/** Thumbnails shared with other explorers, kept least recently used first within a memory budget */
+	TSharedPtr<FRefExplorerThumbnailCache> ThumbnailCache;
 
 	/** Editor for this pool */
 	TWeakPtr<SRefExplorer> RefExplorer;
@@ -273,5 +740,100 @@ private:
 
 	TMap<FAssetIdentifier, FRefExplorerNodeInfo> RefExplorerNodeInfos;
 
+	bool bReadPropertiesFromDisk;
+
+	bool bShowPropertyPins;
+
+	/** Referencing properties of referencers, keyed by referencer, dropped per package when it is saved or updated in the registry */
+	TMap<FAssetIdentifier, TArray<FRefExplorerEditorModule_PRIVATE::FRefPropInfo>> RefPropInfos;
+
+	/** Incremented on every rebuild, so async results gathered for an older graph are dropped */
+	uint32 RebuildSerial;
+
+	TUniquePtr<FRefExplorerUnsavedReferenceScanner> UnsavedReferenceScanner;
+
+	/** Links to the root shown as unsaved or removed, by referencer package, so rescans that change nothing shown do not rebuild */
+	TMap<FName, FRefExplorerEditorModule_PRIVATE::EDependencyPinCategory> UnsavedRootLinks;
+
+	FRefExplorerEditorModule_PRIVATE::ERefExplorerLayoutMode LayoutMode;
+
+	/** Set to cancel the layout job in flight */
+	TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> LayoutCancelled;
+
+	bool bKeepNodePositions;
+
+	/** Set once nodes got their final positions, until then they are at temporary positions and not worth keeping */
+	bool bLayoutApplied;
+
+	bool bClusterReferencers;
+
+	/** Cluster folders the user expanded, valid until the root changes */
+	TSet<FString> ExpandedClusters;
+
+	/** Where the last expanded cluster was, its content is placed around there */
+	FString LastExpandedClusterPath;
+	FIntPoint LastExpandedClusterLoc;
+
+	/** Nodes waiting to be created, in breadth first order, consumed from NodeBuildQueueHead */
+	TArray<FRefExplorerNodeBuildItem> NodeBuildQueue;
+	int32 NodeBuildQueueHead;
+
+	/** Positions to restore once population over several frames is done */
+	TMap<FAssetIdentifier, FIntPoint> PopulatePreviousPositions;
+	FTSTicker::FDelegateHandle PopulateTickerHandle;
+	double PopulateStartTime;
+	double LastPopulateSeconds;
+
+	/** Referencers waiting for their property pins, consumed from PropertyPinQueueHead */
+	TArray<TWeakObjectPtr<UEdGraphNode_RefExplorer>> PropertyPinQueue;
+	int32 PropertyPinQueueHead;
+	FTSTicker::FDelegateHandle PropertyPinTickerHandle;
+
+	/** Nodes created so far, by asset */
+	TMap<FAssetIdentifier, UEdGraphNode_RefExplorer*> BuiltNodes;
+
+	/** Bounds of all nodes, items are indices into SpatialIndexNodes */
+	FRefExplorerSpatialIndex SpatialIndex;
+	TArray<TWeakObjectPtr<UEdGraphNode_RefExplorer>> SpatialIndexNodes;
+	bool bSpatialIndexDirty;
+	uint32 LayoutVersion;
+
+	/** Packages without asset data to check on disk for being maps, once nodes are created */
+	TSet<FName> PendingMapPackages;
+
+	/** Nodes and edges of the current graph if it is too large for graph nodes */
+	FRefExplorerLiteGraph LiteGraph;
+
+	/** Node widgets with their content built */
+	TArray<TWeakPtr<SGraphNode_RefExplorer>> RealizedNodeWidgets;
+
+	/** All node widgets made for this graph, free once the pool holds the only reference. Searched from the cursor, which restarts on rebuild */
+	TArray<TSharedRef<SGraphNode_RefExplorer>> NodeWidgetPool;
+	int32 NodeWidgetPoolCursor;
+	uint64 NodeWidgetPoolWrapFrame;
+
+	/** Folder aggregates of the current nodes, representatives are kept up to date with the spatial index */
+	TArray<FRefExplorerNodeAggregate> NodeAggregates;
+
+	/** Root of the nodes currently in the graph */
+	FAssetIdentifier BuiltGraphRootIdentifier;
+
+	/** Layout cache file of the current graph, its root and hash of its nodes */
+	FString LayoutCacheFilename;
+	FString LayoutCacheRootName;
+	uint32 LayoutCacheNodeSetHash;
+	bool bLayoutCacheDirty;
+
+	/** Packages of blueprints being compiled, their classes and defaults are not safe to scan */
+	TSet<FName> CompilingPackages;
+
+	/** Referencers asked for properties while compiling, refreshed once compilation is done */
+	TSet<FAssetIdentifier> SkippedWhileCompiling;
+
+	FDelegateHandle BlueprintPreCompileHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle PackageSavedHandle;
+
 	friend SRefExplorer;
 };
\ No newline at end of file